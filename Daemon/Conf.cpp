@@ -52,8 +52,17 @@ m_audioInputDevice(),
 m_audioOutputDevice(),
 m_audioMicGain(100U),
 m_audioVolume(100U),
+m_audioSampleRate(48000U),
+m_audioResampler("polyphase"),
+m_audioMMap(false),
+m_audioPeriodTime(0U),
+m_audioBufferTime(0U),
+m_modemProtocol("uart"),
 m_modemPort(),
 m_modemSpeed(460800U),
+m_modemAddress(),
+m_modemNetworkPort(0U),
+m_modemLocalPort(0U),
 m_modemRXInvert(false),
 m_modemTXInvert(false),
 m_modemPTTInvert(false),
@@ -68,6 +77,10 @@ m_modemTXLevel(50.0F),
 m_modemRSSIMappingFile(),
 m_modemTrace(false),
 m_modemDebug(false),
+m_modemCaptureFile(),
+m_modemCaptureSize(16U),
+m_modemThread(false),
+m_modemLowLatency(false),
 m_logDisplayLevel(0U),
 m_logFileLevel(0U),
 m_logFilePath(),
@@ -192,11 +205,29 @@ bool CConf::read()
 				m_audioMicGain = (unsigned int)::atoi(value);
 			else if (::strcmp(key, "Volume") == 0)
 				m_audioVolume = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "SampleRate") == 0)
+				m_audioSampleRate = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "Resampler") == 0)
+				m_audioResampler = value;
+			else if (::strcmp(key, "MMap") == 0)
+				m_audioMMap = ::atoi(value) == 1;
+			else if (::strcmp(key, "PeriodTime") == 0)
+				m_audioPeriodTime = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "BufferTime") == 0)
+				m_audioBufferTime = (unsigned int)::atoi(value);
 		} else if (section == SECTION_MODEM) {
-			if (::strcmp(key, "Port") == 0)
+			if (::strcmp(key, "Protocol") == 0)
+				m_modemProtocol = value;
+			else if (::strcmp(key, "Port") == 0)
 				m_modemPort = value;
 			else if (::strcmp(key, "Speed") == 0)
 				m_modemSpeed = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "Address") == 0)
+				m_modemAddress = value;
+			else if (::strcmp(key, "NetworkPort") == 0)
+				m_modemNetworkPort = (unsigned short)::atoi(value);
+			else if (::strcmp(key, "LocalPort") == 0)
+				m_modemLocalPort = (unsigned short)::atoi(value);
 			else if (::strcmp(key, "RXInvert") == 0)
 				m_modemRXInvert = ::atoi(value) == 1;
 			else if (::strcmp(key, "TXInvert") == 0)
@@ -225,6 +256,14 @@ bool CConf::read()
 				m_modemTrace = ::atoi(value) == 1;
 			else if (::strcmp(key, "Debug") == 0)
 				m_modemDebug = ::atoi(value) == 1;
+			else if (::strcmp(key, "CaptureFile") == 0)
+				m_modemCaptureFile = value;
+			else if (::strcmp(key, "CaptureSize") == 0)
+				m_modemCaptureSize = (unsigned int)::atoi(value);
+			else if (::strcmp(key, "Thread") == 0)
+				m_modemThread = ::atoi(value) == 1;
+			else if (::strcmp(key, "LowLatency") == 0)
+				m_modemLowLatency = ::atoi(value) == 1;
 		} else if (section == SECTION_LOG) {
 			if (::strcmp(key, "FilePath") == 0)
 				m_logFilePath = value;
@@ -345,6 +384,36 @@ unsigned int CConf::getAudioVolume() const
 	return m_audioVolume;
 }
 
+unsigned int CConf::getAudioSampleRate() const
+{
+	return m_audioSampleRate;
+}
+
+std::string CConf::getAudioResampler() const
+{
+	return m_audioResampler;
+}
+
+bool CConf::getAudioMMap() const
+{
+	return m_audioMMap;
+}
+
+unsigned int CConf::getAudioPeriodTime() const
+{
+	return m_audioPeriodTime;
+}
+
+unsigned int CConf::getAudioBufferTime() const
+{
+	return m_audioBufferTime;
+}
+
+std::string CConf::getModemProtocol() const
+{
+	return m_modemProtocol;
+}
+
 std::string CConf::getModemPort() const
 {
 	return m_modemPort;
@@ -355,6 +424,21 @@ unsigned int CConf::getModemSpeed() const
 	return m_modemSpeed;
 }
 
+std::string CConf::getModemAddress() const
+{
+	return m_modemAddress;
+}
+
+unsigned short CConf::getModemNetworkPort() const
+{
+	return m_modemNetworkPort;
+}
+
+unsigned short CConf::getModemLocalPort() const
+{
+	return m_modemLocalPort;
+}
+
 bool CConf::getModemRXInvert() const
 {
 	return m_modemRXInvert;
@@ -425,6 +509,26 @@ bool CConf::getModemDebug() const
 	return m_modemDebug;
 }
 
+std::string CConf::getModemCaptureFile() const
+{
+	return m_modemCaptureFile;
+}
+
+unsigned int CConf::getModemCaptureSize() const
+{
+	return m_modemCaptureSize;
+}
+
+bool CConf::getModemThread() const
+{
+	return m_modemThread;
+}
+
+bool CConf::getModemLowLatency() const
+{
+	return m_modemLowLatency;
+}
+
 unsigned int CConf::getLogDisplayLevel() const
 {
 	return m_logDisplayLevel;
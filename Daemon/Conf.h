@@ -45,10 +45,19 @@ public:
 	std::string  getAudioOutputDevice() const;
 	unsigned int getAudioMicGain() const;
 	unsigned int getAudioVolume() const;
+	unsigned int getAudioSampleRate() const;
+	std::string  getAudioResampler() const;
+	bool         getAudioMMap() const;
+	unsigned int getAudioPeriodTime() const;
+	unsigned int getAudioBufferTime() const;
 
 	// The Modem section
+	std::string  getModemProtocol() const;
 	std::string  getModemPort() const;
 	unsigned int getModemSpeed() const;
+	std::string  getModemAddress() const;
+	unsigned short getModemNetworkPort() const;
+	unsigned short getModemLocalPort() const;
 	bool         getModemRXInvert() const;
 	bool         getModemTXInvert() const;
 	bool         getModemPTTInvert() const;
@@ -63,6 +72,10 @@ public:
 	std::string  getModemRSSIMappingFile() const;
 	bool         getModemTrace() const;
 	bool         getModemDebug() const;
+	std::string  getModemCaptureFile() const;
+	unsigned int getModemCaptureSize() const;
+	bool         getModemThread() const;
+	bool         getModemLowLatency() const;
 
 	// The Log section
 	unsigned int getLogDisplayLevel() const;
@@ -118,9 +131,18 @@ private:
 	std::string  m_audioOutputDevice;
 	unsigned int m_audioMicGain;
 	unsigned int m_audioVolume;
+	unsigned int m_audioSampleRate;
+	std::string  m_audioResampler;
+	bool         m_audioMMap;
+	unsigned int m_audioPeriodTime;
+	unsigned int m_audioBufferTime;
 
+	std::string  m_modemProtocol;
 	std::string  m_modemPort;
 	unsigned int m_modemSpeed;
+	std::string  m_modemAddress;
+	unsigned short m_modemNetworkPort;
+	unsigned short m_modemLocalPort;
 	bool         m_modemRXInvert;
 	bool         m_modemTXInvert;
 	bool         m_modemPTTInvert;
@@ -135,6 +157,10 @@ private:
 	std::string  m_modemRSSIMappingFile;
 	bool         m_modemTrace;
 	bool         m_modemDebug;
+	std::string  m_modemCaptureFile;
+	unsigned int m_modemCaptureSize;
+	bool         m_modemThread;
+	bool         m_modemLowLatency;
 
 	unsigned int m_logDisplayLevel;
 	unsigned int m_logFileLevel;
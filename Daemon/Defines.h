@@ -22,6 +22,8 @@
 const unsigned int CODEC_SAMPLE_RATE = 8000U;
 const unsigned int CODEC_BLOCK_SIZE  = CODEC_SAMPLE_RATE / 25U;
 
+// The default, and highest, sound card rate, the sound card can also run at a
+// lower multiple of the codec rate, down to the codec rate itself
 const unsigned int SOUNDCARD_SAMPLE_RATE = 48000U;
 const unsigned int SOUNDCARD_BLOCK_SIZE  = CODEC_BLOCK_SIZE * (SOUNDCARD_SAMPLE_RATE / CODEC_SAMPLE_RATE);
 
@@ -0,0 +1,288 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "EventLoop.h"
+#include "Log.h"
+
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+
+const unsigned int MAX_EVENTS = 10U;
+#endif
+
+CEventLoop::CEventLoop() :
+m_tick(0U),
+#if defined(__linux__)
+m_epollFD(-1),
+m_eventFD(-1),
+m_timerFD(-1)
+#else
+m_pipe(),
+m_fds()
+#endif
+{
+#if !defined(__linux__)
+	m_pipe[0U] = -1;
+	m_pipe[1U] = -1;
+#endif
+}
+
+CEventLoop::~CEventLoop()
+{
+}
+
+#if defined(__linux__)
+
+bool CEventLoop::open()
+{
+	assert(m_epollFD == -1);
+
+	m_epollFD = ::epoll_create1(EPOLL_CLOEXEC);
+	if (m_epollFD < 0) {
+		LogError("Cannot create the epoll instance, err=%d", errno);
+		return false;
+	}
+
+	m_eventFD = ::eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (m_eventFD < 0) {
+		LogError("Cannot create the eventfd, err=%d", errno);
+		close();
+		return false;
+	}
+
+	m_timerFD = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	if (m_timerFD < 0) {
+		LogError("Cannot create the timerfd, err=%d", errno);
+		close();
+		return false;
+	}
+
+	if (!addFD(m_eventFD) || !addFD(m_timerFD)) {
+		close();
+		return false;
+	}
+
+	return true;
+}
+
+bool CEventLoop::addFD(int fd)
+{
+	assert(m_epollFD != -1);
+	assert(fd >= 0);
+
+	struct epoll_event event;
+	::memset(&event, 0x00, sizeof(struct epoll_event));
+	event.events  = EPOLLIN;
+	event.data.fd = fd;
+
+	if (::epoll_ctl(m_epollFD, EPOLL_CTL_ADD, fd, &event) < 0) {
+		LogError("Cannot add fd %d to the event loop, err=%d", fd, errno);
+		return false;
+	}
+
+	return true;
+}
+
+void CEventLoop::removeFD(int fd)
+{
+	assert(m_epollFD != -1);
+
+	// The modem closes its port before the descriptor is removed. That gives EBADF, and as the port's
+	// descriptor is never duplicated its last reference is gone and so is the registration. ENOENT is
+	// a descriptor that isn't registered, so there is nothing to remove either way.
+	if (::epoll_ctl(m_epollFD, EPOLL_CTL_DEL, fd, NULL) < 0 && errno != EBADF && errno != ENOENT)
+		LogError("Cannot remove fd %d from the event loop, err=%d", fd, errno);
+}
+
+void CEventLoop::setTick(unsigned int ms)
+{
+	assert(m_timerFD != -1);
+	assert(ms > 0U);
+
+	if (ms == m_tick)
+		return;
+
+	m_tick = ms;
+
+	struct itimerspec spec;
+	spec.it_interval.tv_sec  = ms / 1000U;
+	spec.it_interval.tv_nsec = (ms % 1000U) * 1000000L;
+	spec.it_value            = spec.it_interval;
+
+	if (::timerfd_settime(m_timerFD, 0, &spec, NULL) < 0)
+		LogError("Cannot set the event loop tick, err=%d", errno);
+}
+
+void CEventLoop::signal()
+{
+	if (m_eventFD == -1)
+		return;
+
+	uint64_t n = 1U;
+	ssize_t len = ::write(m_eventFD, &n, sizeof(uint64_t));
+	(void)len;
+}
+
+void CEventLoop::wait()
+{
+	assert(m_epollFD != -1);
+
+	struct epoll_event events[MAX_EVENTS];
+	int n = ::epoll_wait(m_epollFD, events, MAX_EVENTS, -1);
+	if (n < 0) {
+		if (errno != EINTR)
+			LogError("Error returned from epoll_wait, err=%d", errno);
+		return;
+	}
+
+	// Reset the internal descriptors, the rest belong to the caller
+	for (int i = 0; i < n; i++) {
+		int fd = events[i].data.fd;
+		if (fd == m_eventFD || fd == m_timerFD) {
+			uint64_t count;
+			ssize_t len = ::read(fd, &count, sizeof(uint64_t));
+			(void)len;
+		}
+	}
+}
+
+void CEventLoop::close()
+{
+	if (m_timerFD != -1) {
+		::close(m_timerFD);
+		m_timerFD = -1;
+	}
+
+	if (m_eventFD != -1) {
+		::close(m_eventFD);
+		m_eventFD = -1;
+	}
+
+	if (m_epollFD != -1) {
+		::close(m_epollFD);
+		m_epollFD = -1;
+	}
+
+	m_tick = 0U;
+}
+
+#else
+
+bool CEventLoop::open()
+{
+	assert(m_pipe[0U] == -1);
+
+	if (::pipe(m_pipe) < 0) {
+		LogError("Cannot create the event loop pipe, err=%d", errno);
+		return false;
+	}
+
+	for (unsigned int i = 0U; i < 2U; i++) {
+		int flags = ::fcntl(m_pipe[i], F_GETFL, 0);
+		::fcntl(m_pipe[i], F_SETFL, flags | O_NONBLOCK);
+	}
+
+	return addFD(m_pipe[0U]);
+}
+
+bool CEventLoop::addFD(int fd)
+{
+	assert(fd >= 0);
+
+	pollfd pfd;
+	pfd.fd      = fd;
+	pfd.events  = POLLIN;
+	pfd.revents = 0;
+
+	m_fds.push_back(pfd);
+
+	return true;
+}
+
+void CEventLoop::removeFD(int fd)
+{
+	assert(!m_fds.empty());
+
+	// The pipe is always the first entry
+	for (std::vector<pollfd>::iterator it = m_fds.begin() + 1; it != m_fds.end(); ++it) {
+		if (it->fd == fd) {
+			m_fds.erase(it);
+			return;
+		}
+	}
+}
+
+void CEventLoop::setTick(unsigned int ms)
+{
+	assert(ms > 0U);
+
+	m_tick = ms;
+}
+
+void CEventLoop::signal()
+{
+	if (m_pipe[1U] == -1)
+		return;
+
+	unsigned char c = 0x00U;
+	ssize_t len = ::write(m_pipe[1U], &c, 1U);
+	(void)len;
+}
+
+void CEventLoop::wait()
+{
+	assert(m_pipe[0U] != -1);
+
+	int n = ::poll(m_fds.data(), m_fds.size(), m_tick > 0U ? int(m_tick) : -1);
+	if (n < 0) {
+		if (errno != EINTR)
+			LogError("Error returned from poll, err=%d", errno);
+		return;
+	}
+
+	if ((m_fds.at(0U).revents & POLLIN) == POLLIN) {
+		unsigned char buffer[100U];
+		while (::read(m_pipe[0U], buffer, 100U) > 0)
+			;
+	}
+}
+
+void CEventLoop::close()
+{
+	for (unsigned int i = 0U; i < 2U; i++) {
+		if (m_pipe[i] != -1) {
+			::close(m_pipe[i]);
+			m_pipe[i] = -1;
+		}
+	}
+
+	m_fds.clear();
+	m_tick = 0U;
+}
+
+#endif
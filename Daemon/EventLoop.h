@@ -0,0 +1,70 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(EVENTLOOP_H)
+#define	EVENTLOOP_H
+
+#if !defined(__linux__)
+#include <vector>
+
+#include <poll.h>
+#endif
+
+/*
+ * Blocks the main loop until there is something for it to do: one of the
+ * watched descriptors is readable, another thread has called signal(), or the
+ * periodic tick has expired. The descriptors are level triggered, so anything
+ * left unread wakes the loop again straight away.
+ *
+ * On Linux this is epoll with an eventfd and a timerfd, elsewhere it falls
+ * back to poll() and a pipe.
+ */
+class CEventLoop {
+public:
+	CEventLoop();
+	~CEventLoop();
+
+	bool open();
+
+	bool addFD(int fd);
+
+	// For a descriptor that has been, or is about to be, closed and replaced
+	void removeFD(int fd);
+
+	void setTick(unsigned int ms);
+
+	// May be called from any thread
+	void signal();
+
+	void wait();
+
+	void close();
+
+private:
+	unsigned int m_tick;
+#if defined(__linux__)
+	int          m_epollFD;
+	int          m_eventFD;
+	int          m_timerFD;
+#else
+	int          m_pipe[2U];
+	std::vector<pollfd> m_fds;
+#endif
+};
+
+#endif
@@ -1,5 +1,5 @@
 /*
- *   Copyright (C) 2010,2016,2021 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2010,2016,2021,2026 by Jonathan Naylor G4KLX
  *
  *   This program is free software; you can redistribute it and/or modify
  *   it under the terms of the GNU General Public License as published by
@@ -19,6 +19,8 @@
 #ifndef Golay24128_H
 #define Golay24128_H
 
+#include <cstdint>
+
 class CGolay24128 {
 public:
 	static unsigned int encode23127(unsigned int data);
@@ -28,6 +30,10 @@ public:
 
 	static bool decode24128(unsigned int in, unsigned int& out);
 	static bool decode24128(unsigned char* in, unsigned int& out);
+
+	// Decode the four codewords of a LICH fragment, returning the number of bits corrected in each,
+	// true only if all four are valid
+	static bool decode24128x4(const uint8_t* lich12, uint32_t out[4], unsigned int errs[4]);
 };
 
 #endif
@@ -0,0 +1,1586 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "M17Convolution.h"
+#include "SPSCRingBuffer.h"
+#include "M17Interleaver.h"
+#include "PolyphaseResampler.h"
+#include "codec2/kiss_fft.h"
+#include "codec2/codec2.h"
+#include "codec2/fastmath.h"
+#include "SRCResampler.h"
+#include "Golay24128.h"
+#include "M17Defines.h"
+#include "Defines.h"
+#include "Log.h"
+#include "M17RX.h"
+#include "M17TX.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <ctime>
+
+const unsigned int DEFAULT_FRAMES = 10000U;
+
+const unsigned int LSF_FEC_BITS  = M17_FRAME_LENGTH_BITS - M17_SYNC_LENGTH_BITS;
+const unsigned int DATA_FEC_BITS = M17_FRAME_LENGTH_BITS - M17_SYNC_LENGTH_BITS - M17_LICH_FRAGMENT_FEC_LENGTH_BITS;
+
+static uint64_t getNS()
+{
+	struct timespec now;
+	::clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+// Every allocation through the replaceable operator new forms is counted, codec2 and the M17 code do not call malloc()
+static std::atomic<uint64_t> m_allocations(0U);
+
+static void* allocate(size_t size, size_t alignment, bool nothrow)
+{
+	m_allocations.fetch_add(1U, std::memory_order_relaxed);
+
+	if (size == 0U)
+		size = 1U;
+
+	void* p = NULL;
+	if (alignment <= alignof(std::max_align_t)) {
+		p = ::malloc(size);
+	} else {
+		// aligned_alloc() wants a multiple of the alignment
+		p = ::aligned_alloc(alignment, (size + alignment - 1U) & ~(alignment - 1U));
+	}
+
+	if (p == NULL && !nothrow)
+		throw std::bad_alloc();
+
+	return p;
+}
+
+void* operator new(size_t size)
+{
+	return allocate(size, 0U, false);
+}
+
+void* operator new[](size_t size)
+{
+	return allocate(size, 0U, false);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+	return allocate(size, 0U, true);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+	return allocate(size, 0U, true);
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+	return allocate(size, size_t(alignment), false);
+}
+
+void* operator new[](size_t size, std::align_val_t alignment)
+{
+	return allocate(size, size_t(alignment), false);
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return allocate(size, size_t(alignment), true);
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return allocate(size, size_t(alignment), true);
+}
+
+void operator delete(void* p) noexcept
+{
+	::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+	::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+	::free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept
+{
+	::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+	::free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+	::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept
+{
+	::free(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept
+{
+	::free(p);
+}
+
+void operator delete(void* p, size_t, std::align_val_t) noexcept
+{
+	::free(p);
+}
+
+void operator delete[](void* p, size_t, std::align_val_t) noexcept
+{
+	::free(p);
+}
+
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept
+{
+	::free(p);
+}
+
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept
+{
+	::free(p);
+}
+
+static uint64_t m_startNS = 0U;
+static uint64_t m_startAllocations = 0U;
+
+static void begin()
+{
+	m_startAllocations = m_allocations.load(std::memory_order_relaxed);
+	m_startNS = getNS();
+}
+
+static void report(const char* stage, const char* variant, unsigned int frames)
+{
+	uint64_t ns = getNS() - m_startNS;
+	uint64_t allocations = m_allocations.load(std::memory_order_relaxed) - m_startAllocations;
+
+	double perFrame = double(ns) / double(frames);
+
+	::fprintf(stdout, "%-12s %-8s %10.0f ns/frame %12.0f frames/s %8.2f allocs/frame\n", stage, variant, perFrame, 1.0E9 / perFrame, double(allocations) / double(frames));
+}
+
+// Hard bits with a random number of errors, and soft bits with random confidences that agree with them
+static void makeFrame(const unsigned char* in, unsigned int nBits, unsigned char* hard, uint8_t* soft)
+{
+	::memcpy(hard, in, (nBits + 7U) / 8U);
+
+	unsigned int nErrors = ::rand() % (nBits / 12U);
+	for (unsigned int i = 0U; i < nErrors; i++) {
+		unsigned int n = ::rand() % nBits;
+		hard[n / 8U] ^= 0x80U >> (n % 8U);
+	}
+
+	for (unsigned int i = 0U; i < nBits; i++) {
+		bool b = (hard[i / 8U] & (0x80U >> (i % 8U))) != 0U;
+		uint8_t confidence = ::rand() % 128;
+		soft[i] = b ? 0x80U + confidence : 0x7FU - confidence;
+	}
+}
+
+// The bit at a time interleaver and byte at a time decorrelator that CM17Interleaver replaced,
+// the permutation comes straight from the quadratic polynomial in the specification
+static unsigned int legacyInterleaver[LSF_FEC_BITS];
+static unsigned char legacyScrambler[M17_FRAME_LENGTH_BYTES];
+
+static void legacyInterleave(const unsigned char* in, unsigned char* out)
+{
+	for (unsigned int i = 0U; i < LSF_FEC_BITS; i++) {
+		unsigned int n1 = i + M17_SYNC_LENGTH_BITS;
+		bool b = (in[n1 / 8U] & (0x80U >> (n1 % 8U))) != 0U;
+		unsigned int n2 = legacyInterleaver[i] + M17_SYNC_LENGTH_BITS;
+		if (b)
+			out[n2 / 8U] |= (0x80U >> (n2 % 8U));
+		else
+			out[n2 / 8U] &= ~(0x80U >> (n2 % 8U));
+	}
+}
+
+static void legacyDecorrelate(const unsigned char* in, unsigned char* out)
+{
+	for (unsigned int i = M17_SYNC_LENGTH_BYTES; i < M17_FRAME_LENGTH_BYTES; i++)
+		out[i] = in[i] ^ legacyScrambler[i];
+}
+
+static bool benchInterleaver(unsigned int frames)
+{
+	for (unsigned int i = 0U; i < LSF_FEC_BITS; i++)
+		legacyInterleaver[i] = (45U * i + 92U * i * i) % LSF_FEC_BITS;
+
+	unsigned char zero[M17_FRAME_LENGTH_BYTES];
+	::memset(zero, 0x00U, M17_FRAME_LENGTH_BYTES);
+	CM17Interleaver::decorrelate(zero, legacyScrambler);
+
+	std::vector<unsigned char> input(frames * M17_FRAME_LENGTH_BYTES);
+	for (unsigned int i = 0U; i < input.size(); i++)
+		input[i] = ::rand();
+
+	unsigned int mismatches = 0U;
+
+	for (unsigned int i = 0U; i < frames; i++) {
+		const unsigned char* in = &input[i * M17_FRAME_LENGTH_BYTES];
+
+		unsigned char temp[M17_FRAME_LENGTH_BYTES];
+		unsigned char out1[M17_FRAME_LENGTH_BYTES], out2[M17_FRAME_LENGTH_BYTES];
+		::memcpy(out1, in, M17_FRAME_LENGTH_BYTES);
+		legacyDecorrelate(in, temp);
+		legacyInterleave(temp, out1);
+
+		CM17Interleaver::decorrelate(in, temp);
+		CM17Interleaver::interleave(temp, out2);
+
+		if (::memcmp(out1, out2, M17_FRAME_LENGTH_BYTES) != 0)
+			mismatches++;
+
+		// Only the LICH is deinterleaved up front on receive
+		unsigned char lich[M17_LICH_FRAGMENT_FEC_LENGTH_BYTES];
+		CM17Interleaver::decodeStart(in, lich, M17_LICH_FRAGMENT_FEC_LENGTH_BYTES);
+
+		if (::memcmp(lich, out2 + M17_SYNC_LENGTH_BYTES, M17_LICH_FRAGMENT_FEC_LENGTH_BYTES) != 0)
+			mismatches++;
+	}
+
+	::fprintf(stdout, "interleaver: verified against the bit at a time code over %u frames, %u mismatches\n", frames, mismatches);
+	if (mismatches > 0U)
+		return false;
+
+	unsigned char out[M17_FRAME_LENGTH_BYTES];
+	::memset(out, 0x00U, M17_FRAME_LENGTH_BYTES);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++) {
+		unsigned char temp[M17_FRAME_LENGTH_BYTES];
+		legacyDecorrelate(&input[i * M17_FRAME_LENGTH_BYTES], temp);
+		legacyInterleave(temp, out);
+	}
+	report("interleaver", "legacy", frames);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++) {
+		unsigned char temp[M17_FRAME_LENGTH_BYTES];
+		CM17Interleaver::decorrelate(&input[i * M17_FRAME_LENGTH_BYTES], temp);
+		CM17Interleaver::interleave(temp, out);
+	}
+	report("interleaver", "table", frames);
+
+	return true;
+}
+
+static bool benchViterbi(unsigned int frames)
+{
+	std::vector<unsigned char> lsfHard(frames * LSF_FEC_BITS / 8U);
+	std::vector<uint8_t>       lsfSoft(frames * LSF_FEC_BITS);
+	std::vector<unsigned char> dataHard(frames * DATA_FEC_BITS / 8U);
+	std::vector<uint8_t>       dataSoft(frames * DATA_FEC_BITS);
+
+	CM17Convolution conv;
+
+	for (unsigned int i = 0U; i < frames; i++) {
+		unsigned char lsf[M17_LSF_LENGTH_BYTES];
+		for (unsigned int j = 0U; j < M17_LSF_LENGTH_BYTES; j++)
+			lsf[j] = ::rand();
+
+		unsigned char encoded[LSF_FEC_BITS / 8U];
+		conv.encodeLinkSetup(lsf, encoded);
+		makeFrame(encoded, LSF_FEC_BITS, &lsfHard[i * LSF_FEC_BITS / 8U], &lsfSoft[i * LSF_FEC_BITS]);
+
+		unsigned char data[M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES];
+		for (unsigned int j = 0U; j < (M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES); j++)
+			data[j] = ::rand();
+
+		conv.encodeData(data, encoded);
+		makeFrame(encoded, DATA_FEC_BITS, &dataHard[i * DATA_FEC_BITS / 8U], &dataSoft[i * DATA_FEC_BITS]);
+	}
+
+	// The SIMD kernel must match the scalar one bit for bit
+	bool simd = CM17Convolution::setSIMD(true);
+	if (!simd) {
+		::fprintf(stdout, "viterbi: no SIMD kernel on this CPU, only the scalar kernel is timed\n");
+	} else {
+		unsigned int mismatches = 0U;
+
+		for (unsigned int i = 0U; i < frames; i++) {
+			unsigned char out1[M17_LSF_LENGTH_BYTES], out2[M17_LSF_LENGTH_BYTES];
+			unsigned int ber1, ber2;
+
+			CM17Convolution::setSIMD(false);
+			ber1 = conv.decodeLinkSetup(&lsfHard[i * LSF_FEC_BITS / 8U], out1);
+			CM17Convolution::setSIMD(true);
+			ber2 = conv.decodeLinkSetup(&lsfHard[i * LSF_FEC_BITS / 8U], out2);
+			if (ber1 != ber2 || ::memcmp(out1, out2, M17_LSF_LENGTH_BYTES) != 0)
+				mismatches++;
+
+			CM17Convolution::setSIMD(false);
+			ber1 = conv.decodeLinkSetupSoft(&lsfSoft[i * LSF_FEC_BITS], out1);
+			CM17Convolution::setSIMD(true);
+			ber2 = conv.decodeLinkSetupSoft(&lsfSoft[i * LSF_FEC_BITS], out2);
+			if (ber1 != ber2 || ::memcmp(out1, out2, M17_LSF_LENGTH_BYTES) != 0)
+				mismatches++;
+
+			CM17Convolution::setSIMD(false);
+			ber1 = conv.decodeData(&dataHard[i * DATA_FEC_BITS / 8U], out1);
+			CM17Convolution::setSIMD(true);
+			ber2 = conv.decodeData(&dataHard[i * DATA_FEC_BITS / 8U], out2);
+			if (ber1 != ber2 || ::memcmp(out1, out2, M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES) != 0)
+				mismatches++;
+
+			CM17Convolution::setSIMD(false);
+			ber1 = conv.decodeDataSoft(&dataSoft[i * DATA_FEC_BITS], out1);
+			CM17Convolution::setSIMD(true);
+			ber2 = conv.decodeDataSoft(&dataSoft[i * DATA_FEC_BITS], out2);
+			if (ber1 != ber2 || ::memcmp(out1, out2, M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES) != 0)
+				mismatches++;
+		}
+
+		::fprintf(stdout, "viterbi: %s kernel verified against the scalar kernel over %u frames, %u mismatches\n", CM17Convolution::getKernel(), frames, mismatches);
+
+		if (mismatches > 0U)
+			return false;
+	}
+
+	for (unsigned int n = 0U; n < 2U; n++) {
+		bool enabled = (n == 1U);
+		if (enabled && !simd)
+			break;
+
+		CM17Convolution::setSIMD(enabled);
+
+		unsigned char out[M17_LSF_LENGTH_BYTES];
+
+		begin();
+		for (unsigned int i = 0U; i < frames; i++)
+			conv.decodeData(&dataHard[i * DATA_FEC_BITS / 8U], out);
+		report("viterbi", CM17Convolution::getKernel(), frames);
+
+		begin();
+		for (unsigned int i = 0U; i < frames; i++)
+			conv.decodeDataSoft(&dataSoft[i * DATA_FEC_BITS], out);
+		report("viterbi-soft", CM17Convolution::getKernel(), frames);
+
+		begin();
+		for (unsigned int i = 0U; i < frames; i++)
+			conv.decodeLinkSetup(&lsfHard[i * LSF_FEC_BITS / 8U], out);
+		report("viterbi-lsf", CM17Convolution::getKernel(), frames);
+	}
+
+	CM17Convolution::setSIMD(true);
+
+	return true;
+}
+
+// Decodes data frames sent as BPSK through additive white Gaussian noise, once from the hard
+// decisions and once from the received levels, at a range of Eb/N0
+static bool benchSoftGain(unsigned int frames)
+{
+	const unsigned int DATA_BITS = (M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES) * 8U;
+	const float RATE = float(DATA_BITS) / float(DATA_FEC_BITS);
+
+	const unsigned int N_POINTS = 5U;
+	const float EBN0_DB[N_POINTS] = {1.0F, 2.0F, 3.0F, 4.0F, 5.0F};
+
+	CM17Convolution conv;
+
+	// Fixed seed so that a run is repeatable
+	std::mt19937 rng(17U);
+	std::normal_distribution<float> gauss(0.0F, 1.0F);
+
+	float hardRate[N_POINTS];
+	float softRate[N_POINTS];
+
+	for (unsigned int n = 0U; n < N_POINTS; n++) {
+		// Unit energy symbols, so the noise is set by the energy per information bit
+		float ebn0  = std::pow(10.0F, EBN0_DB[n] / 10.0F);
+		float sigma = std::sqrt(1.0F / (2.0F * RATE * ebn0));
+
+		unsigned int hardOK = 0U;
+		unsigned int softOK = 0U;
+
+		for (unsigned int i = 0U; i < frames; i++) {
+			unsigned char data[M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES];
+			for (unsigned int j = 0U; j < (M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES); j++)
+				data[j] = rng();
+
+			unsigned char encoded[DATA_FEC_BITS / 8U];
+			conv.encodeData(data, encoded);
+
+			unsigned char hard[DATA_FEC_BITS / 8U];
+			uint8_t soft[DATA_FEC_BITS];
+			::memset(hard, 0x00U, DATA_FEC_BITS / 8U);
+
+			for (unsigned int j = 0U; j < DATA_FEC_BITS; j++) {
+				bool b = (encoded[j / 8U] & (0x80U >> (j % 8U))) != 0U;
+				float level = (b ? 1.0F : -1.0F) + sigma * gauss(rng);
+
+				if (level > 0.0F)
+					hard[j / 8U] |= 0x80U >> (j % 8U);
+
+				// A symbol at the nominal level is three quarters of the way to certain
+				float q = 128.0F + 96.0F * level;
+				soft[j] = uint8_t(std::min(std::max(q, 0.0F), 255.0F));
+			}
+
+			unsigned char out[M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES];
+
+			conv.decodeData(hard, out);
+			if (::memcmp(out, data, M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES) == 0)
+				hardOK++;
+
+			conv.decodeDataSoft(soft, out);
+			if (::memcmp(out, data, M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES) == 0)
+				softOK++;
+		}
+
+		hardRate[n] = float(hardOK) * 100.0F / float(frames);
+		softRate[n] = float(softOK) * 100.0F / float(frames);
+
+		::fprintf(stdout, "softgain     %.1f dB Eb/N0  hard %5.1f%%  soft %5.1f%% of %u data frames decoded\n", EBN0_DB[n], hardRate[n], softRate[n], frames);
+	}
+
+	// Soft decisions should be worth at least 1 dB, so they must do as well as hard decisions do 1 dB higher
+	bool ok = true;
+	for (unsigned int n = 0U; (n + 1U) < N_POINTS; n++) {
+		if (softRate[n] < hardRate[n + 1U]) {
+			::fprintf(stdout, "softgain: soft decisions at %.1f dB are worse than hard decisions at %.1f dB\n", EBN0_DB[n], EBN0_DB[n + 1U]);
+			ok = false;
+		}
+	}
+
+	return ok;
+}
+
+static bool benchGolay(unsigned int frames)
+{
+	std::vector<unsigned char> fragments(frames * M17_LICH_FRAGMENT_FEC_LENGTH_BYTES);
+
+	for (unsigned int i = 0U; i < frames; i++) {
+		unsigned char* fragment = &fragments[i * M17_LICH_FRAGMENT_FEC_LENGTH_BYTES];
+
+		for (unsigned int j = 0U; j < 4U; j++) {
+			unsigned int code = CGolay24128::encode24128(::rand() & 0xFFFU);
+
+			// Up to four errors, so some codewords cannot be corrected
+			unsigned int nErrors = ::rand() % 5;
+			for (unsigned int k = 0U; k < nErrors; k++)
+				code ^= 1U << (::rand() % 24);
+
+			fragment[j * 3U + 0U] = code >> 16;
+			fragment[j * 3U + 1U] = code >> 8;
+			fragment[j * 3U + 2U] = code >> 0;
+		}
+	}
+
+	// The batch decode must agree with four single decodes
+	unsigned int mismatches = 0U;
+
+	for (unsigned int i = 0U; i < frames; i++) {
+		unsigned char* fragment = &fragments[i * M17_LICH_FRAGMENT_FEC_LENGTH_BYTES];
+
+		uint32_t out[4U];
+		unsigned int errs[4U];
+		bool valid1 = CGolay24128::decode24128x4(fragment, out, errs);
+
+		bool valid2 = true;
+		for (unsigned int j = 0U; j < 4U; j++) {
+			unsigned int lich;
+			if (!CGolay24128::decode24128(fragment + j * 3U, lich))
+				valid2 = false;
+			if (lich != out[j])
+				mismatches++;
+		}
+
+		if (valid1 != valid2)
+			mismatches++;
+	}
+
+	::fprintf(stdout, "golay: batch decode verified against single decodes over %u frames, %u mismatches\n", frames, mismatches);
+	if (mismatches > 0U)
+		return false;
+
+	unsigned int total = 0U;
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++) {
+		unsigned char* fragment = &fragments[i * M17_LICH_FRAGMENT_FEC_LENGTH_BYTES];
+		for (unsigned int j = 0U; j < 4U; j++) {
+			unsigned int lich;
+			CGolay24128::decode24128(fragment + j * 3U, lich);
+			total += lich;
+		}
+	}
+	report("golay", "single", frames);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++) {
+		uint32_t out[4U];
+		unsigned int errs[4U];
+		CGolay24128::decode24128x4(&fragments[i * M17_LICH_FRAGMENT_FEC_LENGTH_BYTES], out, errs);
+		total += out[0U] + errs[0U];
+	}
+	report("golay", "batch", frames);
+
+	// Stop the loops being optimised away
+	return total != 0xFFFFFFFFU;
+}
+
+// The soft bits for the convolutional code as the staged receive path used to produce them
+static void stagedSoft(const uint8_t* soft, uint8_t* out)
+{
+	for (unsigned int i = 0U; i < LSF_FEC_BITS; i++) {
+		unsigned int n = CM17Interleaver::getSourceBit(i);
+		out[i] = CM17Interleaver::isScrambled(n) ? soft[n] ^ 0xFFU : soft[n];
+	}
+}
+
+static bool benchFused(unsigned int frames)
+{
+	std::vector<unsigned char> lsfFrames(frames * M17_FRAME_LENGTH_BYTES);
+	std::vector<uint8_t>       lsfSoft(frames * LSF_FEC_BITS);
+	std::vector<unsigned char> dataFrames(frames * M17_FRAME_LENGTH_BYTES);
+	std::vector<uint8_t>       dataSoft(frames * LSF_FEC_BITS);
+
+	CM17Convolution conv;
+
+	for (unsigned int i = 0U; i < frames; i++) {
+		unsigned char frame[M17_FRAME_LENGTH_BYTES], temp[M17_FRAME_LENGTH_BYTES];
+		::memset(frame, 0x00U, M17_FRAME_LENGTH_BYTES);
+
+		unsigned char lsf[M17_LSF_LENGTH_BYTES];
+		for (unsigned int j = 0U; j < M17_LSF_LENGTH_BYTES; j++)
+			lsf[j] = ::rand();
+
+		conv.encodeLinkSetup(lsf, frame + M17_SYNC_LENGTH_BYTES);
+		CM17Interleaver::interleave(frame, temp);
+		CM17Interleaver::decorrelate(temp, frame);
+		makeFrame(frame + M17_SYNC_LENGTH_BYTES, LSF_FEC_BITS, &lsfFrames[i * M17_FRAME_LENGTH_BYTES] + M17_SYNC_LENGTH_BYTES, &lsfSoft[i * LSF_FEC_BITS]);
+
+		for (unsigned int j = 0U; j < M17_LICH_FRAGMENT_FEC_LENGTH_BYTES; j++)
+			frame[M17_SYNC_LENGTH_BYTES + j] = ::rand();
+
+		unsigned char data[M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES];
+		for (unsigned int j = 0U; j < (M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES); j++)
+			data[j] = ::rand();
+
+		conv.encodeData(data, frame + M17_SYNC_LENGTH_BYTES + M17_LICH_FRAGMENT_FEC_LENGTH_BYTES);
+		CM17Interleaver::interleave(frame, temp);
+		CM17Interleaver::decorrelate(temp, frame);
+		makeFrame(frame + M17_SYNC_LENGTH_BYTES, LSF_FEC_BITS, &dataFrames[i * M17_FRAME_LENGTH_BYTES] + M17_SYNC_LENGTH_BYTES, &dataSoft[i * LSF_FEC_BITS]);
+	}
+
+	// The fused decode must match descramble, deinterleave and then decode, bit for bit
+	unsigned int mismatches = 0U;
+
+	for (unsigned int i = 0U; i < frames; i++) {
+		unsigned char temp[M17_FRAME_LENGTH_BYTES], staged[M17_FRAME_LENGTH_BYTES];
+		uint8_t soft[LSF_FEC_BITS];
+		unsigned char out1[M17_LSF_LENGTH_BYTES], out2[M17_LSF_LENGTH_BYTES];
+		unsigned int ber1, ber2;
+
+		const unsigned char* frame = &lsfFrames[i * M17_FRAME_LENGTH_BYTES];
+		CM17Interleaver::decorrelate(frame, temp);
+		CM17Interleaver::interleave(temp, staged);
+		ber1 = conv.decodeLinkSetup(staged + M17_SYNC_LENGTH_BYTES, out1);
+		ber2 = conv.decodeLinkSetupFrame(frame, out2);
+		if (ber1 != ber2 || ::memcmp(out1, out2, M17_LSF_LENGTH_BYTES) != 0)
+			mismatches++;
+
+		stagedSoft(&lsfSoft[i * LSF_FEC_BITS], soft);
+		ber1 = conv.decodeLinkSetupSoft(soft, out1);
+		ber2 = conv.decodeLinkSetupFrameSoft(&lsfSoft[i * LSF_FEC_BITS], out2);
+		if (ber1 != ber2 || ::memcmp(out1, out2, M17_LSF_LENGTH_BYTES) != 0)
+			mismatches++;
+
+		frame = &dataFrames[i * M17_FRAME_LENGTH_BYTES];
+		CM17Interleaver::decorrelate(frame, temp);
+		CM17Interleaver::interleave(temp, staged);
+		ber1 = conv.decodeData(staged + M17_SYNC_LENGTH_BYTES + M17_LICH_FRAGMENT_FEC_LENGTH_BYTES, out1);
+		ber2 = conv.decodeDataFrame(frame, out2);
+		if (ber1 != ber2 || ::memcmp(out1, out2, M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES) != 0)
+			mismatches++;
+
+		stagedSoft(&dataSoft[i * LSF_FEC_BITS], soft);
+		ber1 = conv.decodeDataSoft(soft + M17_LICH_FRAGMENT_FEC_LENGTH_BITS, out1);
+		ber2 = conv.decodeDataFrameSoft(&dataSoft[i * LSF_FEC_BITS], out2);
+		if (ber1 != ber2 || ::memcmp(out1, out2, M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES) != 0)
+			mismatches++;
+	}
+
+	::fprintf(stdout, "fused: verified against the staged decode over %u frames, %u mismatches\n", frames, mismatches);
+	if (mismatches > 0U)
+		return false;
+
+	unsigned char out[M17_LSF_LENGTH_BYTES];
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++) {
+		unsigned char temp[M17_FRAME_LENGTH_BYTES], staged[M17_FRAME_LENGTH_BYTES];
+		CM17Interleaver::decorrelate(&dataFrames[i * M17_FRAME_LENGTH_BYTES], temp);
+		CM17Interleaver::interleave(temp, staged);
+		conv.decodeData(staged + M17_SYNC_LENGTH_BYTES + M17_LICH_FRAGMENT_FEC_LENGTH_BYTES, out);
+	}
+	report("rx-data", "staged", frames);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++)
+		conv.decodeDataFrame(&dataFrames[i * M17_FRAME_LENGTH_BYTES], out);
+	report("rx-data", "fused", frames);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++) {
+		uint8_t soft[LSF_FEC_BITS];
+		stagedSoft(&dataSoft[i * LSF_FEC_BITS], soft);
+		conv.decodeDataSoft(soft + M17_LICH_FRAGMENT_FEC_LENGTH_BITS, out);
+	}
+	report("rx-soft", "staged", frames);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++)
+		conv.decodeDataFrameSoft(&dataSoft[i * LSF_FEC_BITS], out);
+	report("rx-soft", "fused", frames);
+
+	return true;
+}
+
+// The audio is a sweep so that codec2 has something more than silence to work on
+static void makeAudio(std::vector<float>& audio)
+{
+	for (unsigned int i = 0U; i < audio.size(); i++) {
+		float t = float(i % SOUNDCARD_SAMPLE_RATE) / float(SOUNDCARD_SAMPLE_RATE);
+		audio[i] = 0.3F * ::sinf(2.0F * float(M_PI) * (300.0F + 2000.0F * t) * t);
+	}
+}
+
+// CM17RX should play the link setup silence and then each voice frame decoded and resampled, with nothing lost or
+// out of order, so build that independently from the frames sent to it and compare
+static bool checkRX(const char* name, const std::vector<unsigned char>& sent, const std::vector<float>& played, unsigned int sampleRate)
+{
+	const unsigned int SILENCE_BLOCKS = 5U;
+
+	unsigned int blockSize = (CODEC_BLOCK_SIZE * sampleRate) / CODEC_SAMPLE_RATE;
+
+	CCodec2Decoder decoder(true);
+	CM17Convolution conv;
+	CPolyphaseResampler interpolator(CODEC_SAMPLE_RATE, sampleRate);
+
+	std::vector<float> expected(SILENCE_BLOCKS * blockSize, 0.0F);
+
+	for (unsigned int i = 0U; i < sent.size(); i += 1U + sent[i]) {
+		const unsigned char* data = &sent[i + 1U];
+		if (data[0U] != TAG_DATA)
+			continue;
+
+		unsigned char frame[M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES];
+		conv.decodeDataFrame(data + 2U, frame);
+
+		short audio[CODEC_BLOCK_SIZE];
+		decoder.codec2_decode(audio + 0U,   frame + M17_FN_LENGTH_BYTES + 0U);
+		decoder.codec2_decode(audio + 160U, frame + M17_FN_LENGTH_BYTES + 8U);
+
+		float f8000[CODEC_BLOCK_SIZE];
+		for (unsigned int j = 0U; j < CODEC_BLOCK_SIZE; j++)
+			f8000[j] = float(audio[j]) / 32768.0F;
+
+		if (sampleRate == CODEC_SAMPLE_RATE) {
+			expected.insert(expected.end(), f8000, f8000 + CODEC_BLOCK_SIZE);
+		} else {
+			std::vector<float> block(blockSize);
+			interpolator.process(f8000, CODEC_BLOCK_SIZE, block.data(), blockSize);
+			expected.insert(expected.end(), block.begin(), block.end());
+		}
+	}
+
+	if (played.size() != expected.size()) {
+		::fprintf(stdout, "chain: CM17RX played %u samples at %s, expected %u\n", (unsigned int)played.size(), name, (unsigned int)expected.size());
+		return false;
+	}
+
+	float error = 0.0F;
+	for (unsigned int i = 0U; i < played.size(); i++)
+		error = std::max(error, std::fabs(played[i] - expected[i]));
+
+	if (error > 0.0F) {
+		::fprintf(stdout, "chain: CM17RX audio at %s differs from the frames sent to it, max error %.2e\n", name, error);
+		return false;
+	}
+
+	return true;
+}
+
+// Each stage of the two chains on its own, then audio through CM17TX and its frames back through CM17RX
+static bool benchChain(unsigned int frames)
+{
+	std::vector<float> audio(frames * SOUNDCARD_BLOCK_SIZE);
+	makeAudio(audio);
+
+	// Creating a codec pair, the shared windows and FFT configs are only built by the first one
+	begin();
+	for (unsigned int i = 0U; i < frames; i++) {
+		CCodec2Encoder encoder(true);
+		CCodec2Decoder decoder(true);
+	}
+	report("codec2-init", "enc+dec", frames);
+
+	CCodec2Encoder encoder3200(true);
+	CCodec2Encoder encoder1600(false);
+	CCodec2Decoder decoder3200(true);
+	CCodec2Decoder decoder1600(false);
+
+	CPolyphaseResampler decimator(SOUNDCARD_SAMPLE_RATE, CODEC_SAMPLE_RATE);
+	CPolyphaseResampler interpolator(CODEC_SAMPLE_RATE, SOUNDCARD_SAMPLE_RATE);
+
+	std::vector<short> speech(frames * CODEC_BLOCK_SIZE);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++) {
+		float f8000[CODEC_BLOCK_SIZE];
+		decimator.process(&audio[i * SOUNDCARD_BLOCK_SIZE], SOUNDCARD_BLOCK_SIZE, f8000, CODEC_BLOCK_SIZE);
+
+		for (unsigned int j = 0U; j < CODEC_BLOCK_SIZE; j++)
+			speech[i * CODEC_BLOCK_SIZE + j] = short(f8000[j] * 32768.0F + 0.5F);
+	}
+	report("resample-tx", decimator.getName(), frames);
+
+	std::vector<unsigned char> payloads(frames * (M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES));
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++) {
+		unsigned char* payload = &payloads[i * (M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES)];
+		payload[0U] = (i >> 8) & 0xFFU;
+		payload[1U] = (i >> 0) & 0xFFU;
+
+		encoder3200.codec2_encode(payload + M17_FN_LENGTH_BYTES + 0U, &speech[i * CODEC_BLOCK_SIZE + 0U]);
+		encoder3200.codec2_encode(payload + M17_FN_LENGTH_BYTES + 8U, &speech[i * CODEC_BLOCK_SIZE + 160U]);
+	}
+	report("codec2-enc", "3200", frames);
+
+	CM17Convolution conv;
+	std::vector<unsigned char> encoded(frames * M17_FRAME_LENGTH_BYTES);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++)
+		conv.encodeData(&payloads[i * (M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES)], &encoded[i * M17_FRAME_LENGTH_BYTES] + M17_SYNC_LENGTH_BYTES + M17_LICH_FRAGMENT_FEC_LENGTH_BYTES);
+	report("conv-enc", "data", frames);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++) {
+		unsigned char* lich = &encoded[i * M17_FRAME_LENGTH_BYTES] + M17_SYNC_LENGTH_BYTES;
+		for (unsigned int j = 0U; j < 4U; j++) {
+			unsigned int code = CGolay24128::encode24128((i + j) & 0xFFFU);
+			lich[j * 3U + 0U] = code >> 16;
+			lich[j * 3U + 1U] = code >> 8;
+			lich[j * 3U + 2U] = code >> 0;
+		}
+	}
+	report("golay-enc", "lich", frames);
+
+	std::vector<unsigned char> received(frames * M17_FRAME_LENGTH_BYTES);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++) {
+		unsigned char temp[M17_FRAME_LENGTH_BYTES];
+		CM17Interleaver::interleave(&encoded[i * M17_FRAME_LENGTH_BYTES], temp);
+		CM17Interleaver::decorrelate(temp, &received[i * M17_FRAME_LENGTH_BYTES]);
+	}
+	report("interleave", "tx", frames);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++) {
+		unsigned char fragment[M17_LICH_FRAGMENT_FEC_LENGTH_BYTES];
+		CM17Interleaver::decodeStart(&received[i * M17_FRAME_LENGTH_BYTES], fragment, M17_LICH_FRAGMENT_FEC_LENGTH_BYTES);
+
+		uint32_t lich[4U];
+		unsigned int errs[4U];
+		CGolay24128::decode24128x4(fragment, lich, errs);
+	}
+	report("golay-dec", "lich", frames);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++)
+		conv.decodeDataFrame(&received[i * M17_FRAME_LENGTH_BYTES], &payloads[i * (M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES)]);
+	report("conv-dec", "data", frames);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++) {
+		const unsigned char* payload = &payloads[i * (M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES)];
+		decoder3200.codec2_decode(&speech[i * CODEC_BLOCK_SIZE + 0U],   payload + M17_FN_LENGTH_BYTES + 0U);
+		decoder3200.codec2_decode(&speech[i * CODEC_BLOCK_SIZE + 160U], payload + M17_FN_LENGTH_BYTES + 8U);
+	}
+	report("codec2-dec", "3200", frames);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++) {
+		float f8000[CODEC_BLOCK_SIZE];
+		for (unsigned int j = 0U; j < CODEC_BLOCK_SIZE; j++)
+			f8000[j] = float(speech[i * CODEC_BLOCK_SIZE + j]) / 32768.0F;
+
+		interpolator.process(f8000, CODEC_BLOCK_SIZE, &audio[i * SOUNDCARD_BLOCK_SIZE], SOUNDCARD_BLOCK_SIZE);
+	}
+	report("resample-rx", interpolator.getName(), frames);
+
+	CSPSCRingBuffer<float> ring(SOUNDCARD_BLOCK_SIZE * 4U, "Bench");
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++) {
+		float block[SOUNDCARD_BLOCK_SIZE];
+		ring.addData(&audio[i * SOUNDCARD_BLOCK_SIZE], SOUNDCARD_BLOCK_SIZE);
+		ring.getData(block, SOUNDCARD_BLOCK_SIZE);
+	}
+	report("ring", "spsc", frames);
+
+	// The whole chain, as the main loop and the sound card callbacks drive it
+	makeAudio(audio);
+
+	CRSSIInterpolator rssi;
+
+	CM17TX tx("G4KLX", "M17Bench", 100U, encoder3200, encoder1600);
+	tx.setDestination("ALL");
+	tx.setParams(0U, 3200U);
+
+	// Fresh decoders so that the RX output can be checked against a decode from a known state
+	CCodec2Decoder rxDecoder3200(true);
+	CCodec2Decoder rxDecoder1600(false);
+
+	CM17RX rx(std::string(), &rssi, false, rxDecoder3200, rxDecoder1600);
+	rx.setVolume(100U);
+
+	tx.start();
+
+	unsigned int count = 0U;
+
+	// Reserved up front so that keeping a copy does not show up as allocations
+	std::vector<unsigned char> sent;
+	sent.reserve((frames + 2U) * (M17_FRAME_LENGTH_BYTES + 3U));
+	std::vector<float> played;
+	played.reserve((frames + 10U) * SOUNDCARD_BLOCK_SIZE);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++) {
+		tx.write(&audio[i * SOUNDCARD_BLOCK_SIZE], SOUNDCARD_BLOCK_SIZE);
+		tx.process();
+
+		unsigned char data[M17_FRAME_LENGTH_BYTES + 2U];
+		unsigned int len;
+		while ((len = tx.read(data)) > 0U) {
+			sent.push_back(len);
+			sent.insert(sent.end(), data, data + len);
+
+			rx.write(data, len);
+			count++;
+		}
+
+		float block[SOUNDCARD_BLOCK_SIZE];
+		while ((len = rx.read(block, SOUNDCARD_BLOCK_SIZE)) > 0U)
+			played.insert(played.end(), block, block + len);
+	}
+	report("chain", "tx+rx", frames);
+
+	tx.end();
+	tx.process();
+
+	// The link setup plus one frame per block of audio
+	if (count != (frames + 1U)) {
+		::fprintf(stdout, "chain: %u frames out of CM17TX for %u blocks of audio\n", count, frames);
+		return false;
+	}
+
+	if (!checkRX("48000", sent, played, SOUNDCARD_SAMPLE_RATE))
+		return false;
+
+	// Again with the sound card at the codec rate and no resampling, the sweep is well below 4 kHz
+	std::vector<float> audio8000(frames * CODEC_BLOCK_SIZE);
+	for (unsigned int i = 0U; i < audio8000.size(); i++)
+		audio8000[i] = audio[i * (SOUNDCARD_SAMPLE_RATE / CODEC_SAMPLE_RATE)];
+
+	CM17TX tx8000("G4KLX", "M17Bench", 100U, encoder3200, encoder1600, CODEC_SAMPLE_RATE);
+	tx8000.setDestination("ALL");
+	tx8000.setParams(0U, 3200U);
+
+	CCodec2Decoder rxDecoder3200At8000(true);
+	CCodec2Decoder rxDecoder1600At8000(false);
+
+	CM17RX rx8000(std::string(), &rssi, false, rxDecoder3200At8000, rxDecoder1600At8000, CODEC_SAMPLE_RATE);
+	rx8000.setVolume(100U);
+
+	tx8000.start();
+
+	count = 0U;
+
+	sent.clear();
+	played.clear();
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++) {
+		tx8000.write(&audio8000[i * CODEC_BLOCK_SIZE], CODEC_BLOCK_SIZE);
+		tx8000.process();
+
+		unsigned char data[M17_FRAME_LENGTH_BYTES + 2U];
+		unsigned int len;
+		while ((len = tx8000.read(data)) > 0U) {
+			sent.push_back(len);
+			sent.insert(sent.end(), data, data + len);
+
+			rx8000.write(data, len);
+			count++;
+		}
+
+		float block[CODEC_BLOCK_SIZE];
+		while ((len = rx8000.read(block, CODEC_BLOCK_SIZE)) > 0U)
+			played.insert(played.end(), block, block + len);
+	}
+	report("chain", "8000", frames);
+
+	tx8000.end();
+	tx8000.process();
+
+	if (count != (frames + 1U)) {
+		::fprintf(stdout, "chain: %u frames out of CM17TX at 8 kHz for %u blocks of audio\n", count, frames);
+		return false;
+	}
+
+	return checkRX("8000", sent, played, CODEC_SAMPLE_RATE);
+}
+
+// The gain of a tone through the resampler once it has settled, and its delay when the
+// frequency is unchanged, which for a linear phase filter is also the group delay
+static void measureTone(IResampler& resampler, unsigned int inRate, unsigned int outRate, float inFreq, float outFreq, float& gain, float& delay)
+{
+	const unsigned int BLOCKS = 20U;
+	const unsigned int SETTLE = 5U;
+
+	unsigned int inLen  = inRate  / 25U;
+	unsigned int outLen = outRate / 25U;
+
+	std::vector<float> in(inLen);
+	std::vector<float> out(outLen);
+
+	resampler.reset();
+
+	double i = 0.0;
+	double q = 0.0;
+
+	for (unsigned int block = 0U; block < BLOCKS; block++) {
+		for (unsigned int n = 0U; n < inLen; n++)
+			in[n] = 0.5F * ::sinf(2.0F * float(M_PI) * inFreq * float(block * inLen + n) / float(inRate));
+
+		resampler.process(in.data(), inLen, out.data(), outLen);
+
+		if (block < SETTLE)
+			continue;
+
+		for (unsigned int m = 0U; m < outLen; m++) {
+			double theta = 2.0 * M_PI * outFreq * double(block * outLen + m) / double(outRate);
+			i += out[m] * ::sin(theta);
+			q += out[m] * ::cos(theta);
+		}
+	}
+
+	double n = double((BLOCKS - SETTLE) * outLen);
+	double amplitude = 2.0 * ::sqrt(i * i + q * q) / n;
+	gain = float(20.0 * ::log10(amplitude / 0.5 + 1.0E-12));
+
+	double phase = ::atan2(-q, i);
+	if (phase < 0.0)
+		phase += 2.0 * M_PI;
+	delay = float(1000.0 * phase / (2.0 * M_PI * outFreq));
+}
+
+// libsamplerate against the polyphase filters, for CPU and for the delay, passband gain and rejection of the images
+static bool benchResampler(unsigned int frames)
+{
+	std::vector<float> audio(frames * SOUNDCARD_BLOCK_SIZE);
+	makeAudio(audio);
+
+	std::vector<float> speech(frames * CODEC_BLOCK_SIZE);
+
+	for (unsigned int type = 0U; type < 2U; type++) {
+		IResampler* decimator;
+		IResampler* interpolator;
+		if (type == 0U) {
+			decimator    = new CSRCResampler(SOUNDCARD_SAMPLE_RATE, CODEC_SAMPLE_RATE);
+			interpolator = new CSRCResampler(CODEC_SAMPLE_RATE, SOUNDCARD_SAMPLE_RATE);
+		} else {
+			decimator    = new CPolyphaseResampler(SOUNDCARD_SAMPLE_RATE, CODEC_SAMPLE_RATE);
+			interpolator = new CPolyphaseResampler(CODEC_SAMPLE_RATE, SOUNDCARD_SAMPLE_RATE);
+		}
+
+		begin();
+		for (unsigned int i = 0U; i < frames; i++)
+			decimator->process(&audio[i * SOUNDCARD_BLOCK_SIZE], SOUNDCARD_BLOCK_SIZE, &speech[i * CODEC_BLOCK_SIZE], CODEC_BLOCK_SIZE);
+		report("resample-tx", decimator->getName(), frames);
+
+		begin();
+		for (unsigned int i = 0U; i < frames; i++)
+			interpolator->process(&speech[i * CODEC_BLOCK_SIZE], CODEC_BLOCK_SIZE, &audio[i * SOUNDCARD_BLOCK_SIZE], SOUNDCARD_BLOCK_SIZE);
+		report("resample-rx", interpolator->getName(), frames);
+
+		// 5 kHz aliases down to 3 kHz, and 3 kHz leaves an image at 5 kHz
+		float gain, delay, image, unused;
+		measureTone(*decimator, SOUNDCARD_SAMPLE_RATE, CODEC_SAMPLE_RATE, 100.0F, 100.0F, gain, delay);
+		measureTone(*decimator, SOUNDCARD_SAMPLE_RATE, CODEC_SAMPLE_RATE, 5000.0F, 3000.0F, image, unused);
+		::fprintf(stdout, "%-12s %-8s %6.2f ms delay %8.2f dB at 100 Hz %8.1f dB alias\n", "resample-tx", decimator->getName(), delay, gain, image);
+
+		measureTone(*interpolator, CODEC_SAMPLE_RATE, SOUNDCARD_SAMPLE_RATE, 100.0F, 100.0F, gain, delay);
+		measureTone(*interpolator, CODEC_SAMPLE_RATE, SOUNDCARD_SAMPLE_RATE, 3000.0F, 5000.0F, image, unused);
+		::fprintf(stdout, "%-12s %-8s %6.2f ms delay %8.2f dB at 100 Hz %8.1f dB image\n", "resample-rx", interpolator->getName(), delay, gain, image);
+
+		delete decimator;
+		delete interpolator;
+	}
+
+	return true;
+}
+
+// The largest difference between two spectra, relative to the largest bin of the first
+static float fftError(const std::vector<std::complex<float>>& a, const std::vector<std::complex<float>>& b)
+{
+	float peak  = 0.0F;
+	float error = 0.0F;
+
+	for (unsigned int i = 0U; i < a.size(); i++) {
+		peak  = std::max(peak,  std::abs(a[i]));
+		error = std::max(error, std::abs(a[i] - b[i]));
+	}
+
+	return error / peak;
+}
+
+// The generic kiss_fft butterflies against the vectorised power of two path, for the codec2 transform sizes
+static bool benchFFT(unsigned int frames)
+{
+	const float MAX_ERROR = 1.0E-5F;
+
+	CKissFFT kiss;
+
+	std::vector<std::complex<float>> in(FFT_ENC);
+	for (unsigned int i = 0U; i < in.size(); i++)
+		in[i] = std::complex<float>(float(::rand()) / float(RAND_MAX) - 0.5F, float(::rand()) / float(RAND_MAX) - 0.5F);
+
+	std::vector<std::complex<float>> out1(FFT_ENC), out2(FFT_ENC);
+
+	bool ok = true;
+
+	// Complex forward, as used by dft_speech() and the NLP pitch estimator
+	FFT_STATE fwd1, fwd2;
+	kiss.fft_alloc(fwd1, FFT_ENC, false, false);
+	kiss.fft_alloc(fwd2, FFT_ENC, false, true);
+
+	kiss.fft(fwd1, in.data(), out1.data());
+	kiss.fft(fwd2, in.data(), out2.data());
+
+	float error = fftError(out1, out2);
+	::fprintf(stdout, "fft: complex %u point forward, %s path, relative error %.2e\n", FFT_ENC, fwd2.simd ? "vector" : "generic", error);
+	if (error > MAX_ERROR)
+		ok = false;
+
+	// Real forward and inverse, as used by aks_to_M2() and synthesise()
+	FFTR_STATE rfwd1, rfwd2, rinv1, rinv2;
+	kiss.fftr_alloc(rfwd1, FFT_ENC, false, false);
+	kiss.fftr_alloc(rfwd2, FFT_ENC, false, true);
+	kiss.fftr_alloc(rinv1, FFT_DEC, true,  false);
+	kiss.fftr_alloc(rinv2, FFT_DEC, true,  true);
+
+	const float* real = (const float*)in.data();
+	std::vector<std::complex<float>> spec1(FFT_ENC / 2 + 1), spec2(FFT_ENC / 2 + 1);
+	kiss.fftr(rfwd1, real, spec1.data());
+	kiss.fftr(rfwd2, real, spec2.data());
+
+	error = fftError(spec1, spec2);
+	::fprintf(stdout, "fft: real %u point forward, relative error %.2e\n", FFT_ENC, error);
+	if (error > MAX_ERROR)
+		ok = false;
+
+	std::vector<std::complex<float>> time1(FFT_DEC / 2), time2(FFT_DEC / 2);
+	kiss.fftri(rinv1, spec1.data(), (float*)time1.data());
+	kiss.fftri(rinv2, spec1.data(), (float*)time2.data());
+
+	error = fftError(time1, time2);
+	::fprintf(stdout, "fft: real %u point inverse, relative error %.2e\n", FFT_DEC, error);
+	if (error > MAX_ERROR)
+		ok = false;
+
+	if (!ok)
+		return false;
+
+	// In place, as Cnlp::codec2_fft_inplace() calls it
+	out2 = in;
+	kiss.fft(fwd2, out2.data(), out2.data());
+	error = fftError(out1, out2);
+	if (error > MAX_ERROR) {
+		::fprintf(stdout, "fft: complex %u point forward in place, relative error %.2e\n", FFT_ENC, error);
+		return false;
+	}
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++)
+		kiss.fft(fwd1, in.data(), out1.data());
+	report("fft-c512", "generic", frames);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++)
+		kiss.fft(fwd2, in.data(), out2.data());
+	report("fft-c512", "vector", frames);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++)
+		kiss.fftr(rfwd1, real, spec1.data());
+	report("fftr-512", "generic", frames);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++)
+		kiss.fftr(rfwd2, real, spec2.data());
+	report("fftr-512", "vector", frames);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++)
+		kiss.fftri(rinv1, spec1.data(), (float*)time1.data());
+	report("fftri-512", "generic", frames);
+
+	begin();
+	for (unsigned int i = 0U; i < frames; i++)
+		kiss.fftri(rinv2, spec1.data(), (float*)time2.data());
+	report("fftri-512", "vector", frames);
+
+	return true;
+}
+
+// The codebook searches as they were, with the codebooks stored as arrays of structures
+static long legacyQuantise(const float* cb, const float* vec, const float* w, int k, int m, float* se)
+{
+	long besti = 0;
+	float beste = 1E32;
+
+	for (long j = 0; j < m; j++) {
+		float e = 0.0;
+		for (int i = 0; i < k; i++) {
+			float diff = cb[j * k + i] - vec[i];
+			e += (diff * w[i] * diff * w[i]);
+		}
+
+		if (e < beste) {
+			beste = e;
+			besti = j;
+		}
+	}
+
+	*se += beste;
+
+	return besti;
+}
+
+static int legacyFindNearestWeighted(const float* codebook, int nb_entries, const float* x, const float* w, int ndim)
+{
+	float min_dist = 1e15;
+	int nearest = 0;
+
+	for (int i = 0; i < nb_entries; i++) {
+		float dist = 0;
+		for (int j = 0; j < ndim; j++)
+			dist += w[j] * (x[j] - codebook[i * ndim + j]) * (x[j] - codebook[i * ndim + j]);
+
+		if (dist < min_dist) {
+			min_dist = dist;
+			nearest = i;
+		}
+	}
+
+	return nearest;
+}
+
+static std::vector<float> toAoS(const lsp_codebook& cb)
+{
+	std::vector<float> aos(cb.k * cb.m);
+	for (int j = 0; j < cb.m; j++) {
+		for (int i = 0; i < cb.k; i++)
+			aos[j * cb.k + i] = cb.cb[i * cb.m + j];
+	}
+
+	return aos;
+}
+
+static float randomFloat(float lo, float hi)
+{
+	return lo + (hi - lo) * float(::rand()) / float(RAND_MAX);
+}
+
+// Opens up the searches in CQbase
+class CBenchQuantiser : public CQuantize {
+public:
+	using CQbase::quantise;
+	using CQbase::find_nearest_weighted;
+};
+
+// The vectorised codebook searches against the original scalar ones, they must pick the same entries
+static bool benchQuantiser(unsigned int frames)
+{
+	CBenchQuantiser qt;
+
+	std::vector<std::vector<float>> lspd(LPC_ORD), lsp(LPC_ORD);
+	for (unsigned int i = 0U; i < LPC_ORD; i++) {
+		lspd[i] = toAoS(lsp_cbd[i]);
+		lsp[i]  = toAoS(lsp_cb[i]);
+	}
+
+	std::vector<float> ge = toAoS(ge_cb[0]);
+
+	unsigned int mismatches = 0U;
+
+	for (unsigned int n = 0U; n < frames; n++) {
+		for (unsigned int i = 0U; i < LPC_ORD; i++) {
+			for (unsigned int type = 0U; type < 2U; type++) {
+				const lsp_codebook& cb = type == 0U ? lsp_cbd[i] : lsp_cb[i];
+				const std::vector<float>& aos = type == 0U ? lspd[i] : lsp[i];
+
+				// Random values, and every few frames an exact tie between two neighbouring entries
+				float vec[1];
+				int j = ::rand() % (cb.m - 1);
+				if ((n % 4U) == 0U)
+					vec[0] = 0.5F * (cb.cb[j] + cb.cb[j + 1]);
+				else
+					vec[0] = randomFloat(cb.cb[0] - 100.0F, cb.cb[cb.m - 1] + 100.0F);
+
+				float w[1] = { (n % 2U) == 0U ? 1.0F : randomFloat(0.1F, 10.0F) };
+
+				float se1 = 0.0F, se2 = 0.0F;
+				long index1 = legacyQuantise(aos.data(), vec, w, cb.k, cb.m, &se1);
+				long index2 = qt.quantise(cb.cb, vec, w, cb.k, cb.m, &se2);
+				if (index1 != index2 || se1 != se2)
+					mismatches++;
+			}
+		}
+
+		float x[2] = { randomFloat(-2.0F, 4.0F), randomFloat(-20.0F, 40.0F) };
+		float w[2] = { randomFloat(0.0F, 3600.0F), randomFloat(0.0F, 3.0F) };
+
+		int index1 = legacyFindNearestWeighted(ge.data(), ge_cb[0].m, x, w, ge_cb[0].k);
+		int index2 = qt.find_nearest_weighted(ge_cb[0].cb, ge_cb[0].m, x, w, ge_cb[0].k);
+		if (index1 != index2)
+			mismatches++;
+	}
+
+	::fprintf(stdout, "quantiser: verified against the scalar searches over %u frames, %u mismatches\n", frames, mismatches);
+	if (mismatches > 0U)
+		return false;
+
+	// One frame is the ten differential LSP searches of a 3200 encode, or one joint Wo and energy search
+	std::vector<float> input(frames * LPC_ORD);
+	for (unsigned int i = 0U; i < input.size(); i++)
+		input[i] = randomFloat(0.0F, 500.0F);
+
+	float w[2] = { 1.0F, 1.0F };
+	float se = 0.0F;
+	long sum = 0;
+
+	begin();
+	for (unsigned int n = 0U; n < frames; n++) {
+		for (unsigned int i = 0U; i < LPC_ORD; i++)
+			sum += legacyQuantise(lspd[i].data(), &input[n * LPC_ORD + i], w, lsp_cbd[i].k, lsp_cbd[i].m, &se);
+	}
+	report("quantise", "scalar", frames);
+
+	begin();
+	for (unsigned int n = 0U; n < frames; n++) {
+		for (unsigned int i = 0U; i < LPC_ORD; i++)
+			sum += qt.quantise(lsp_cbd[i].cb, &input[n * LPC_ORD + i], w, lsp_cbd[i].k, lsp_cbd[i].m, &se);
+	}
+	report("quantise", "vector", frames);
+
+	begin();
+	for (unsigned int n = 0U; n < frames; n++)
+		sum += legacyFindNearestWeighted(ge.data(), ge_cb[0].m, &input[n * LPC_ORD], w, ge_cb[0].k);
+	report("woe-vq", "scalar", frames);
+
+	begin();
+	for (unsigned int n = 0U; n < frames; n++)
+		sum += qt.find_nearest_weighted(ge_cb[0].cb, ge_cb[0].m, &input[n * LPC_ORD], w, ge_cb[0].k);
+	report("woe-vq", "vector", frames);
+
+	// Keep the searches from being optimised away
+	if (sum < 0)
+		::fprintf(stdout, "%ld %f\n", sum, se);
+
+	return true;
+}
+
+// Something close enough to speech for the decoder: syllables of a glottal pulse train with a wandering pitch
+// through three formants, separated by fricative noise and short silences
+static void makeSpeech(std::vector<short>& speech)
+{
+	const float FORMANTS[][3] = {{700.0F, 1200.0F, 2600.0F}, {300.0F, 2300.0F, 3000.0F}, {500.0F, 900.0F, 2400.0F}, {400.0F, 1900.0F, 2500.0F}};
+
+	float state[3U][2U] = {{0.0F}};
+	float phase = 0.0F;
+	float hp = 0.0F;
+
+	for (unsigned int i = 0U; i < speech.size(); i++) {
+		float t = float(i) / float(CODEC_SAMPLE_RATE);
+
+		unsigned int syllable = i / 2000U;			// 250ms each
+		float pos = float(i % 2000U) / 2000.0F;
+
+		float f0 = 120.0F + 40.0F * ::sinf(2.0F * float(M_PI) * 0.7F * t) + 20.0F * float(syllable % 3U);
+
+		float excitation = 0.0F;
+		float gain = 0.0F;
+		if (pos < 0.7F) {
+			// Voiced, a pulse per pitch period with a little noise
+			phase += f0 / float(CODEC_SAMPLE_RATE);
+			if (phase >= 1.0F) {
+				phase -= 1.0F;
+				excitation = 1.0F;
+			}
+			excitation += 0.02F * (float(::rand()) / float(RAND_MAX) - 0.5F);
+			gain = ::sinf(float(M_PI) * pos / 0.7F);
+		} else if (pos < 0.85F && (syllable % 2U) == 0U) {
+			// Unvoiced, high passed noise
+			float noise = float(::rand()) / float(RAND_MAX) - 0.5F;
+			excitation = noise - hp;
+			hp = noise;
+			gain = 0.3F;
+		}
+
+		const float* formants = FORMANTS[syllable % 4U];
+
+		float out = 0.0F;
+		for (unsigned int j = 0U; j < 3U; j++) {
+			float r = 0.97F - 0.03F * float(j);
+			float y = excitation + 2.0F * r * ::cosf(2.0F * float(M_PI) * formants[j] / float(CODEC_SAMPLE_RATE)) * state[j][0U] - r * r * state[j][1U];
+			state[j][1U] = state[j][0U];
+			state[j][0U] = y;
+			out += y / float(j + 1U);
+		}
+
+		speech[i] = short(std::max(-32767.0F, std::min(32767.0F, 1500.0F * gain * out)));
+	}
+}
+
+// Raw 16 bit little endian 8 kHz mono, as from "sox in.wav -r 8000 -c 1 -t s16 out.raw"
+static bool readSpeech(const char* fileName, std::vector<short>& speech)
+{
+	FILE* fp = ::fopen(fileName, "rb");
+	if (fp == NULL) {
+		::fprintf(stderr, "fastmath: cannot open %s\n", fileName);
+		return false;
+	}
+
+	short buffer[CODEC_BLOCK_SIZE];
+	size_t n;
+	while ((n = ::fread(buffer, sizeof(short), CODEC_BLOCK_SIZE, fp)) == CODEC_BLOCK_SIZE)
+		speech.insert(speech.end(), buffer, buffer + n);
+
+	::fclose(fp);
+
+	return !speech.empty();
+}
+
+// Worst case error of one of the approximations against libm over a range of inputs
+static bool kernelError(const char* name, double from, double to, double maxError, bool relative, float (*fast)(float), double (*exact)(double))
+{
+	double error = 0.0;
+	for (double x = from; x < to; x += (to - from) / 1000000.0) {
+		double e = std::fabs(double(fast(float(x))) - exact(double(float(x))));
+		if (relative)
+			e /= std::fabs(exact(double(float(x))));
+		error = std::max(error, e);
+	}
+
+	::fprintf(stdout, "fastmath: %-6s %s error %.2e\n", name, relative ? "relative" : "absolute", error);
+
+	return error <= maxError;
+}
+
+static float fastSin(float x) { float s, c; fast_sincosf(x, &s, &c); return s; }
+static float fastCos(float x) { float s, c; fast_sincosf(x, &s, &c); return c; }
+static float fastAtan(float x) { return fast_atan2f(x, 1.0F - 0.5F * x); }
+static double exactAtan(double x) { return std::atan2(x, double(1.0F - 0.5F * float(x))); }
+static float fastPow(float x) { return fast_powf(x, float(LPCPF_BETA)); }
+static double exactPow(double x) { return std::pow(x, double(float(LPCPF_BETA))); }
+
+// SNR of one decoder's output against another's, over the whole corpus
+static double decoderSNR(const std::vector<short>& ref, const std::vector<short>& test)
+{
+	double signal = 1.0E-30;
+	double noise  = 1.0E-30;
+
+	for (unsigned int i = 0U; i < ref.size(); i++) {
+		double diff = double(ref[i]) - double(test[i]);
+		signal += double(ref[i]) * double(ref[i]);
+		noise  += diff * diff;
+	}
+
+	return 10.0 * std::log10(signal / noise);
+}
+
+// The fastmath.h approximations against libm, then the fast decoder against the reference one on the same bits
+static bool benchFastMath(unsigned int frames, const std::vector<std::string>& files)
+{
+	// Rounding differences alone measure over 90 dB, a voicing or post filter decision going the other way is much lower
+	const double MIN_SNR = 30.0;
+
+	bool ok = true;
+	ok = kernelError("sin",   -1000.0, 1000.0,  2.0E-7, false, fastSin,     ::sin)   && ok;
+	ok = kernelError("cos",   -1000.0, 1000.0,  2.0E-7, false, fastCos,     ::cos)   && ok;
+	ok = kernelError("atan2", -100.0,  100.0,   5.0E-6, false, fastAtan,    exactAtan)  && ok;
+	ok = kernelError("log2",  1.0E-6,  1.0E6,   2.0E-7, true,  fast_log2f,  ::log2)  && ok;
+	ok = kernelError("exp2",  -120.0,  120.0,   3.0E-7, true,  fast_exp2f,  ::exp2)  && ok;
+	ok = kernelError("pow",   1.0E-12, 1.0E12,  1.0E-6, true,  fastPow,     exactPow)   && ok;
+
+	std::vector<std::vector<short>> corpus;
+	if (files.empty()) {
+		corpus.push_back(std::vector<short>(frames * CODEC_BLOCK_SIZE));
+		makeSpeech(corpus.back());
+	} else {
+		for (const std::string& file : files) {
+			corpus.push_back(std::vector<short>());
+			if (!readSpeech(file.c_str(), corpus.back()))
+				return false;
+		}
+	}
+
+	for (unsigned int mode = 0U; mode < 2U; mode++) {
+		bool is3200 = mode == 0U;
+		const char* name = is3200 ? "3200" : "1600";
+
+		for (unsigned int n = 0U; n < corpus.size(); n++) {
+			const std::vector<short>& speech = corpus[n];
+			unsigned int blocks = speech.size() / CODEC_BLOCK_SIZE;
+
+			CCodec2Encoder encoder(is3200);
+			unsigned int samples = encoder.codec2_samples_per_frame();
+			unsigned int bytes   = (encoder.codec2_bits_per_frame() + 7) / 8;
+			unsigned int count   = speech.size() / samples;
+
+			std::vector<unsigned char> bits(count * bytes);
+			for (unsigned int i = 0U; i < count; i++)
+				encoder.codec2_encode(&bits[i * bytes], &speech[i * samples]);
+
+			CCodec2Decoder reference(is3200);
+			CCodec2Decoder fast(is3200);
+			reference.set_fast_math(false);
+			fast.set_fast_math(true);
+
+			std::vector<short> out1(count * samples), out2(count * samples);
+
+			begin();
+			for (unsigned int i = 0U; i < count; i++)
+				reference.codec2_decode(&out1[i * samples], &bits[i * bytes]);
+			report("codec2-dec", is3200 ? "libm3200" : "libm1600", blocks);
+
+			begin();
+			for (unsigned int i = 0U; i < count; i++)
+				fast.codec2_decode(&out2[i * samples], &bits[i * bytes]);
+			report("codec2-dec", is3200 ? "fast3200" : "fast1600", blocks);
+
+			double snr = decoderSNR(out1, out2);
+			::fprintf(stdout, "fastmath: %s %s, fast against libm decoder SNR %.1f dB\n", name, files.empty() ? "synthetic" : files[n].c_str(), snr);
+			if (snr < MIN_SNR)
+				ok = false;
+		}
+	}
+
+	return ok;
+}
+
+int main(int argc, char** argv)
+{
+	std::string test = "all";
+	unsigned int frames = DEFAULT_FRAMES;
+
+	if (argc > 1)
+		test = argv[1];
+	if (argc > 2)
+		frames = (unsigned int)::atoi(argv[2]);
+
+	std::vector<std::string> files;
+	for (int i = 3; i < argc; i++)
+		files.push_back(argv[i]);
+
+	if (frames == 0U) {
+		::fprintf(stderr, "Usage: M17Bench [all|interleaver|viterbi|softgain|fused|golay|chain|resampler|fft|quantiser|fastmath] [frames] [speech.raw ...]\n");
+		return 1;
+	}
+
+	// Only warnings and errors from the code under test
+	::LogInitialise(false, std::string(), std::string(), 0U, 4U, false);
+
+	bool ok = true;
+
+	if (test != "all" && test != "interleaver" && test != "viterbi" && test != "softgain" && test != "fused" && test != "golay" && test != "chain" &&
+	    test != "resampler" && test != "fft" && test != "quantiser" && test != "fastmath") {
+		::fprintf(stderr, "Usage: M17Bench [all|interleaver|viterbi|softgain|fused|golay|chain|resampler|fft|quantiser|fastmath] [frames] [speech.raw ...]\n");
+		return 1;
+	}
+
+	if (test == "all" || test == "interleaver")
+		ok = benchInterleaver(frames) && ok;
+
+	if (test == "all" || test == "viterbi")
+		ok = benchViterbi(frames) && ok;
+
+	if (test == "all" || test == "softgain")
+		ok = benchSoftGain(frames) && ok;
+
+	if (test == "all" || test == "fused")
+		ok = benchFused(frames) && ok;
+
+	if (test == "all" || test == "golay")
+		ok = benchGolay(frames) && ok;
+
+	if (test == "all" || test == "chain")
+		ok = benchChain(frames) && ok;
+
+	if (test == "all" || test == "resampler")
+		ok = benchResampler(frames) && ok;
+
+	if (test == "all" || test == "fft")
+		ok = benchFFT(frames) && ok;
+
+	if (test == "all" || test == "quantiser")
+		ok = benchQuantiser(frames) && ok;
+
+	if (test == "all" || test == "fastmath")
+		ok = benchFastMath(frames, files) && ok;
+
+	return ok ? 0 : 1;
+}
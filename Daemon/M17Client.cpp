@@ -17,13 +17,14 @@
  */
 
 #include "M17Client.h"
+#include "M17Replay.h"
+#include "NetworkController.h"
 #include "UARTController.h"
 #include "codec2/codec2.h"
 #include "GitVersion.h"
 #include "UDPSocket.h"
 #include "StopWatch.h"
 #include "Version.h"
-#include "Thread.h"
 #include "Modem.h"
 #include "Log.h"
 
@@ -35,6 +36,8 @@
 #include "SoundALSA.h"
 #endif
 
+#include <cstdint>
+#include <climits>
 #include <cstdio>
 #include <vector>
 
@@ -46,8 +49,14 @@
 
 const char* DEFAULT_INI_FILE = "/etc/M17Client.ini";
 
+const char* DEFAULT_WAV_FILE = "M17Replay.wav";
+
 const char* DELIMITER = ":";
 
+// How often the modem is clocked while transmitting and while idle, in ms
+const unsigned int TX_TICK   = 10U;
+const unsigned int IDLE_TICK = 50U;
+
 static bool m_killed = false;
 static int  m_signal = 0;
 
@@ -65,6 +74,8 @@ const char* HEADER4 = "Copyright(C) 2021 by Jonathan Naylor, G4KLX and others";
 int main(int argc, char** argv)
 {
 	const char* iniFile = DEFAULT_INI_FILE;
+	const char* replayFile = NULL;
+	const char* wavFile = DEFAULT_WAV_FILE;
 
 	if (argc > 1) {
 		for (int currentArg = 1; currentArg < argc; ++currentArg) {
@@ -72,8 +83,12 @@ int main(int argc, char** argv)
 			if ((arg == "-v") || (arg == "--version")) {
 				::fprintf(stdout, "M17Client version %s git #%.7s\n", VERSION, gitversion);
 				return 0;
+			} else if (arg == "--replay" && (currentArg + 1) < argc) {
+				replayFile = argv[++currentArg];
+			} else if (arg == "--wav" && (currentArg + 1) < argc) {
+				wavFile = argv[++currentArg];
 			} else if (arg.substr(0,1) == "-") {
-				::fprintf(stderr, "Usage: M17Client [-v|--version] [filename]\n");
+				::fprintf(stderr, "Usage: M17Client [-v|--version] [--replay <frame file> [--wav <wav file>]] [filename]\n");
 				return 1;
 			} else {
 				iniFile = argv[currentArg];
@@ -81,6 +96,18 @@ int main(int argc, char** argv)
 		}
 	}
 
+	// Decode a recorded frame file offline, no ini file, modem or sound card are needed
+	if (replayFile != NULL) {
+		::LogInitialise(false, std::string(), std::string(), 0U, 2U, false);
+
+		CM17Replay replay(replayFile, wavFile);
+		int ret = replay.run();
+
+		::LogFinalise();
+
+		return ret;
+	}
+
 	::signal(SIGINT,  sigHandler);
 	::signal(SIGTERM, sigHandler);
 	::signal(SIGHUP,  sigHandler);
@@ -111,11 +138,16 @@ int main(int argc, char** argv)
 CM17Client::CM17Client(const std::string& confFile) :
 m_conf(confFile),
 m_codePlug(NULL),
+m_capture(NULL),
+m_modemThread(NULL),
 m_rx(NULL),
 m_tx(NULL),
 m_tx1(false),
 m_tx2(false),
 m_socket(NULL),
+m_eventLoop(),
+m_pttTimer(),
+m_pttWaiting(false),
 #if defined(USE_HAMLIB)
 m_hamLib(NULL),
 #endif
@@ -138,8 +170,10 @@ void CM17Client::readCallback(const float* input, unsigned int nSamples, int id)
 {
 	assert(m_tx != NULL);
 
-	if (nSamples > 0U)
+	if (nSamples > 0U && m_tx->isTX()) {
 		m_tx->write(input, nSamples);
+		m_eventLoop.signal();
+	}
 }
 
 void CM17Client::writeCallback(float* output, int& nSamples, int id)
@@ -240,7 +274,35 @@ int CM17Client::run()
 
 	m_modem = new CModem(false, m_conf.getModemPTTInvert(), m_conf.getModemTXDelay(), 0U, false, m_conf.getModemTrace(), m_conf.getModemDebug());
 
-	m_modem->setPort(new CUARTController(m_conf.getModemPort(), m_conf.getModemSpeed()));
+	std::string protocol = m_conf.getModemProtocol();
+	if (protocol == "tcp" || protocol == "udp") {
+		m_modem->setPort(new CNetworkController(protocol == "tcp" ? MP_TCP : MP_UDP, m_conf.getModemAddress(), m_conf.getModemNetworkPort(), m_conf.getModemLocalPort()));
+	} else {
+		CUARTController* port = new CUARTController(m_conf.getModemPort(), m_conf.getModemSpeed());
+		port->setLowLatency(m_conf.getModemLowLatency());
+		m_modem->setPort(port);
+	}
+
+	std::string captureFile = m_conf.getModemCaptureFile();
+	if (!captureFile.empty()) {
+		// The capture ring uses 32 bit offsets, so the size in bytes must fit in an unsigned int
+		uint64_t captureSize = uint64_t(m_conf.getModemCaptureSize()) * 1024U * 1024U;
+		if (captureSize > UINT_MAX) {
+			LogError("The capture size of %u MB is too large", m_conf.getModemCaptureSize());
+			::LogFinalise();
+			return 1;
+		}
+
+		m_capture = new CModemCapture(captureFile, (unsigned int)captureSize);
+		ret = m_capture->open();
+		if (!ret) {
+			LogError("Unable to open the capture file");
+			::LogFinalise();
+			return 1;
+		}
+
+		m_modem->setCapture(m_capture);
+	}
 
 	bool rxInvert = m_conf.getModemRXInvert();
 	if (m_codePlug->getData().at(0U).m_rxInvertSet)
@@ -330,17 +392,32 @@ int CM17Client::run()
 	}
 #endif
 
-	CCodec2 codec3200(true);
-	CCodec2 codec1600(false);
+	CCodec2Encoder encoder3200(true);
+	CCodec2Encoder encoder1600(false);
+	CCodec2Decoder decoder3200(true);
+	CCodec2Decoder decoder1600(false);
 
 	CRSSIInterpolator* rssi = new CRSSIInterpolator;
 	if (!m_conf.getModemRSSIMappingFile().empty())
 		rssi->load(m_conf.getModemRSSIMappingFile());
 
-	m_tx = new CM17TX(m_conf.getCallsign(), m_conf.getText(), m_conf.getAudioMicGain(), codec3200, codec1600);
+	unsigned int sampleRate = m_conf.getAudioSampleRate();
+	if (sampleRate < CODEC_SAMPLE_RATE || sampleRate > SOUNDCARD_SAMPLE_RATE || (sampleRate % CODEC_SAMPLE_RATE) != 0U) {
+		LogError("The sound card rate must be a multiple of %u Hz up to %u Hz", CODEC_SAMPLE_RATE, SOUNDCARD_SAMPLE_RATE);
+		::LogFinalise();
+		return 1;
+	}
+
+	RESAMPLER_TYPE resampler = m_conf.getAudioResampler() == "src" ? RT_SRC : RT_POLYPHASE;
+	if (sampleRate == CODEC_SAMPLE_RATE)
+		LogMessage("Running the sound card at the codec rate, with no resampling");
+	else
+		LogMessage("Using the %s resampler", resampler == RT_SRC ? "libsamplerate" : "polyphase");
+
+	m_tx = new CM17TX(m_conf.getCallsign(), m_conf.getText(), m_conf.getAudioMicGain(), encoder3200, encoder1600, sampleRate, resampler);
 	m_tx->setDestination("ALL");
 
-	m_rx = new CM17RX(m_conf.getCallsign(), rssi, m_conf.getBleep(), codec3200, codec1600);
+	m_rx = new CM17RX(m_conf.getCallsign(), rssi, m_conf.getBleep(), decoder3200, decoder1600, sampleRate, resampler);
 	m_rx->setVolume(m_conf.getAudioVolume());
 	m_rx->setStatusCallback(this);
 
@@ -354,11 +431,13 @@ int CM17Client::run()
 	m_tx->setParams(m_codePlug->getData().at(0U).m_can, m_codePlug->getData().at(0U).m_mode);
 
 #if defined(USE_PULSEAUDIO)
-	m_sound = new CSoundPulse(m_conf.getAudioInputDevice(), m_conf.getAudioOutputDevice(), SOUNDCARD_SAMPLE_RATE, SOUNDCARD_BLOCK_SIZE);
+	m_sound = new CSoundPulse(m_conf.getAudioInputDevice(), m_conf.getAudioOutputDevice(), sampleRate, sampleRate / 25U);
 #elif defined(USE_SNDIO)
-	m_sound = new CSoundSndio(m_conf.getAudioInputDevice(), m_conf.getAudioOutputDevice(), SOUNDCARD_SAMPLE_RATE, SOUNDCARD_BLOCK_SIZE);
+	m_sound = new CSoundSndio(m_conf.getAudioInputDevice(), m_conf.getAudioOutputDevice(), sampleRate, sampleRate / 25U);
 #else
-	m_sound = new CSoundALSA(m_conf.getAudioInputDevice(), m_conf.getAudioOutputDevice(), SOUNDCARD_SAMPLE_RATE, SOUNDCARD_BLOCK_SIZE);
+	CSoundALSA* alsa = new CSoundALSA(m_conf.getAudioInputDevice(), m_conf.getAudioOutputDevice(), sampleRate, sampleRate / 25U);
+	alsa->setBuffering(m_conf.getAudioMMap(), m_conf.getAudioPeriodTime(), m_conf.getAudioBufferTime());
+	m_sound = alsa;
 #endif
 
 	m_sound->setCallback(this);
@@ -369,31 +448,39 @@ int CM17Client::run()
 		return 1;
 	}
 
+	ret = m_eventLoop.open();
+	if (!ret) {
+		LogError("Unable to open the event loop");
+		::LogFinalise();
+		return 1;
+	}
+
+	int fd;
+	int modemFD = -1;
+	if (m_conf.getModemThread()) {
+		m_modemThread = new CModemThread(m_modem, m_eventLoop);
+		ret = m_modemThread->start();
+		if (!ret) {
+			LogError("Unable to start the modem thread");
+			::LogFinalise();
+			return 1;
+		}
+	} else {
+		modemFD = m_modem->getPortFD();
+		if (modemFD >= 0)
+			m_eventLoop.addFD(modemFD);
+	}
+
+	fd = m_socket->getFD();
+	if (fd >= 0)
+		m_eventLoop.addFD(fd);
+
 	CStopWatch stopWatch;
 	stopWatch.start();
 
 	LogMessage("M17Client-%s is running", VERSION);
 
 	while (!m_killed) {
-		m_tx->process();
-
-		bool tx = false;
-		if (m_modem->hasM17Space()) {
-			unsigned char data[M17_FRAME_LENGTH_BYTES];
-			unsigned int len = m_tx->read(data);
-			if (len > 0U) {
-				m_modem->writeM17Data(data, len);
-				tx = true;
-			}
-		}
-
-		if (!tx) {
-			unsigned char data[M17_FRAME_LENGTH_BYTES];
-			unsigned int len = m_modem->readM17Data(data);
-			if (len > 0U)
-				m_rx->write(data, len);
-		}
-
 		char command[100U];
 		sockaddr_storage sockaddr;
 		unsigned int sockaddrLen = 0U;
@@ -421,8 +508,7 @@ int CM17Client::run()
 
 			if (tx && !m_tx1 && !m_tx2) {
 				LogDebug("\tTransmitter on");
-				m_tx->start();
-				sendTX(true);
+				startTX();
 			} else if (!tx && !m_tx1 && m_tx2) {
 				LogDebug("\tTransmitter off");
 				m_tx->end();
@@ -454,6 +540,11 @@ int CM17Client::run()
 		}
 #endif
 
+		// Any PTT change above goes out to the modem on this pass
+		m_tx->process();
+
+		bool tx = writeTX();
+
 		unsigned int ms = stopWatch.elapsed();
 		stopWatch.start();
 
@@ -461,10 +552,41 @@ int CM17Client::run()
 		if (m_gpsd != NULL)
 			m_gpsd->clock(ms);
 #endif
-		m_modem->clock(ms);
+		if (m_modemThread == NULL) {
+			m_modem->clock(ms);
+
+			// The reopened port has a new descriptor to wait on
+			if (m_modem->needsReset()) {
+				if (modemFD >= 0)
+					m_eventLoop.removeFD(modemFD);
+
+				m_modem->reset();
+
+				modemFD = m_modem->getPortFD();
+				if (modemFD >= 0)
+					m_eventLoop.addFD(modemFD);
+			}
+		}
+
+		// After the clock, so that frames it has just parsed are decoded now and not on the next wakeup
+		if (!tx) {
+			unsigned char data[M17_FRAME_LENGTH_BYTES + 4U];
+			unsigned int len;
+			while ((len = m_modemThread != NULL ? m_modemThread->readM17Data(data) : m_modem->readM17Data(data)) > 0U)
+				m_rx->write(data, len);
+		}
 
-		if (ms < 10U)
-			CThread::sleep(10U);
+#if defined(USE_GPIO)
+		// The PTT and volume buttons are polled
+		if (m_gpio != NULL || m_tx->isTX())
+#else
+		if (m_tx->isTX())
+#endif
+			m_eventLoop.setTick(TX_TICK);
+		else
+			m_eventLoop.setTick(IDLE_TICK);
+
+		m_eventLoop.wait();
 	}
 
 #if defined(USE_HAMLIB)
@@ -488,10 +610,21 @@ int CM17Client::run()
 	}
 #endif
 
+	if (m_modemThread != NULL) {
+		m_modemThread->stop();
+		delete m_modemThread;
+	}
+
 	m_socket->close();
 	m_sound->close();
+	m_eventLoop.close();
 	m_modem->close();
 
+	if (m_capture != NULL) {
+		m_capture->close();
+		delete m_capture;
+	}
+
 	delete m_codePlug;
 	delete m_tx;
 	delete m_rx;
@@ -503,6 +636,44 @@ int CM17Client::run()
 	return 0;
 }
 
+void CM17Client::startTX()
+{
+	m_tx->start();
+	sendTX(true);
+
+	m_pttTimer.start();
+	m_pttWaiting = true;
+}
+
+bool CM17Client::writeTX()
+{
+	bool tx = false;
+
+	// Everything that is ready goes to the modem together
+	while (m_modemThread != NULL ? m_modemThread->hasM17Space() : m_modem->hasM17Space()) {
+		unsigned char data[M17_FRAME_LENGTH_BYTES + 4U];
+		unsigned int len = m_tx->read(data);
+		if (len == 0U)
+			break;
+
+		if (m_modemThread != NULL)
+			m_modemThread->writeM17Data(data, len);
+		else
+			m_modem->writeM17Data(data, len);
+
+		if (m_pttWaiting && data[0U] == TAG_HEADER) {
+			unsigned int ms = m_pttTimer.elapsed();
+			// Measured to the host side queue only, the modem adds its TX delay and its own buffering after that
+			LogMessage("PTT to modem queue: %u ms, the configured TX delay adds an estimated %u ms before going to air", ms, m_conf.getModemTXDelay());
+			m_pttWaiting = false;
+		}
+
+		tx = true;
+	}
+
+	return tx;
+}
+
 void CM17Client::parseCommand(char* command)
 {
 	assert(command != NULL);
@@ -531,8 +702,7 @@ void CM17Client::parseCommand(char* command)
 		} else if (::strcmp(ptrs.at(1U), "1") == 0) {
 			if (!m_tx1 && !m_tx2) {
 				LogDebug("\tTransmitter on");
-				m_tx->start();
-				sendTX(true);
+				startTX();
 			}
 			m_tx1 = true;
 		} else {
@@ -600,8 +770,14 @@ bool CM17Client::processChannelRequest(const char* channel)
 			if (chan.m_txInvertSet)
 				txInvert = chan.m_txInvert;
 
-			if (!m_modem->changeFrequency(chan.m_rxFrequency, m_conf.getModemRXOffset(), rxInvert,
-						      chan.m_txFrequency, m_conf.getModemTXOffset(), txInvert))
+			bool ret;
+			if (m_modemThread != NULL)
+				ret = m_modemThread->changeFrequency(chan.m_rxFrequency, m_conf.getModemRXOffset(), rxInvert,
+								     chan.m_txFrequency, m_conf.getModemTXOffset(), txInvert);
+			else
+				ret = m_modem->changeFrequency(chan.m_rxFrequency, m_conf.getModemRXOffset(), rxInvert,
+							       chan.m_txFrequency, m_conf.getModemTXOffset(), txInvert);
+			if (!ret)
 				return false;
 
 			m_tx->setParams(chan.m_can, chan.m_mode);
@@ -22,6 +22,9 @@
 #include "StatusCallback.h"
 #include "AudioBackend.h"
 #include "AudioCallback.h"
+#include "ModemThread.h"
+#include "EventLoop.h"
+#include "StopWatch.h"
 #include "UDPSocket.h"
 #if defined(USE_HAMLIB)
 #include "HamLib.h"
@@ -63,12 +66,17 @@ private:
 	CConf            m_conf;
 	CCodePlug*       m_codePlug;
 	CModem*          m_modem;
+	CModemCapture*   m_capture;
+	CModemThread*    m_modemThread;
 	CM17RX*          m_rx;
 	CM17TX*          m_tx;
 	bool             m_tx1;
 	bool             m_tx2;
 	IAudioBackend*   m_sound;
 	CUDPSocket*      m_socket;
+	CEventLoop       m_eventLoop;
+	CStopWatch       m_pttTimer;
+	bool             m_pttWaiting;
 #if defined(USE_HAMLIB)
 	CHamLib*         m_hamLib;
 #endif
@@ -85,6 +93,9 @@ private:
 
 	void sendTX(bool tx);
 
+	void startTX();
+	bool writeTX();
+
 	void sendChannelList();
 	void sendDestinationList();
 
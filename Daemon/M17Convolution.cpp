@@ -17,12 +17,24 @@
  */
 
 #include "M17Convolution.h"
+#include "M17Interleaver.h"
+#include "M17Defines.h"
 
 #include <cstdio>
 #include <cassert>
 #include <cstring>
 #include <cstdlib>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#if !defined(__aarch64__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+#endif
+
 const unsigned int PUNCTURE_LIST_LINK_SETUP_COUNT = 60U;
 
 const unsigned int PUNCTURE_LIST_LINK_SETUP[] = {
@@ -44,32 +56,276 @@ const unsigned char BIT_MASK_TABLE[] = {0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04U
 #define WRITE_BIT1(p,i,b) p[(i)>>3] = (b) ? (p[(i)>>3] | BIT_MASK_TABLE[(i)&7]) : (p[(i)>>3] & ~BIT_MASK_TABLE[(i)&7])
 #define READ_BIT1(p,i)    (p[(i)>>3] & BIT_MASK_TABLE[(i)&7])
 
-const uint8_t BRANCH_TABLE1[] = {0U, 0U, 0U, 0U, 2U, 2U, 2U, 2U};
-const uint8_t BRANCH_TABLE2[] = {0U, 2U, 2U, 0U, 0U, 2U, 2U, 0U};
+// The soft symbols fed to the trellis, the 8-bit confidences are quantised down to these
+const uint8_t SOFT_ZERO    = 0U;
+const uint8_t SOFT_ERASURE = 8U;
+const uint8_t SOFT_ONE     = 16U;
+
+const uint8_t BRANCH_TABLE1[] = {SOFT_ZERO, SOFT_ZERO, SOFT_ZERO, SOFT_ZERO, SOFT_ONE, SOFT_ONE, SOFT_ONE, SOFT_ONE};
+const uint8_t BRANCH_TABLE2[] = {SOFT_ZERO, SOFT_ONE, SOFT_ONE, SOFT_ZERO, SOFT_ZERO, SOFT_ONE, SOFT_ONE, SOFT_ZERO};
 
 const unsigned int NUM_OF_STATES_D2 = 8U;
 const unsigned int NUM_OF_STATES = 16U;
-const uint32_t     M = 4U;
+const uint32_t     M = 2U * SOFT_ONE;
 const unsigned int K = 5U;
 
+#define	QUANTISE_SOFT(c) uint8_t((uint32_t(c) + 8U) >> 4)
+
+const unsigned int MAX_DECISIONS = 300U;
+
+/*
+ * One trellis step for all 16 states. The path metrics never exceed 244 * M, so
+ * the saturating adds in the SIMD kernels never saturate and all of the kernels
+ * produce identical metrics and decisions.
+ */
+typedef void (*ACS_KERNEL)(const uint16_t* oldMetrics, uint16_t* newMetrics, uint64_t* decisions, uint8_t s0, uint8_t s1);
+
+static void acsScalar(const uint16_t* oldMetrics, uint16_t* newMetrics, uint64_t* decisions, uint8_t s0, uint8_t s1)
+{
+	*decisions = 0U;
+
+	for (uint8_t i = 0U; i < NUM_OF_STATES_D2; i++) {
+		uint8_t j = i * 2U;
+
+		uint16_t metric = std::abs(BRANCH_TABLE1[i] - s0) + std::abs(BRANCH_TABLE2[i] - s1);
+
+		uint16_t m0 = oldMetrics[i] + metric;
+		uint16_t m1 = oldMetrics[i + NUM_OF_STATES_D2] + (M - metric);
+		uint8_t decision0 = (m0 >= m1) ? 1U : 0U;
+		newMetrics[j + 0U] = decision0 != 0U ? m1 : m0;
+
+		m0 = oldMetrics[i] + (M - metric);
+		m1 = oldMetrics[i + NUM_OF_STATES_D2] + metric;
+		uint8_t decision1 = (m0 >= m1) ? 1U : 0U;
+		newMetrics[j + 1U] = decision1 != 0U ? m1 : m0;
+
+		*decisions |= (uint64_t(decision1) << (j + 1U)) | (uint64_t(decision0) << (j + 0U));
+	}
+}
+
+#if defined(__SSE2__)
+
+static void acsSSE2(const uint16_t* oldMetrics, uint16_t* newMetrics, uint64_t* decisions, uint8_t s0, uint8_t s1)
+{
+	const __m128i branch1 = _mm_setr_epi16(BRANCH_TABLE1[0U], BRANCH_TABLE1[1U], BRANCH_TABLE1[2U], BRANCH_TABLE1[3U],
+						BRANCH_TABLE1[4U], BRANCH_TABLE1[5U], BRANCH_TABLE1[6U], BRANCH_TABLE1[7U]);
+	const __m128i branch2 = _mm_setr_epi16(BRANCH_TABLE2[0U], BRANCH_TABLE2[1U], BRANCH_TABLE2[2U], BRANCH_TABLE2[3U],
+						BRANCH_TABLE2[4U], BRANCH_TABLE2[5U], BRANCH_TABLE2[6U], BRANCH_TABLE2[7U]);
+
+	__m128i sym0 = _mm_set1_epi16(s0);
+	__m128i sym1 = _mm_set1_epi16(s1);
+
+	// |a - b| without SSSE3
+	__m128i metric = _mm_add_epi16(_mm_max_epi16(_mm_sub_epi16(branch1, sym0), _mm_sub_epi16(sym0, branch1)),
+				       _mm_max_epi16(_mm_sub_epi16(branch2, sym1), _mm_sub_epi16(sym1, branch2)));
+	__m128i inverse = _mm_sub_epi16(_mm_set1_epi16(M), metric);
+
+	__m128i lo = _mm_load_si128((const __m128i*)(oldMetrics + 0U));
+	__m128i hi = _mm_load_si128((const __m128i*)(oldMetrics + NUM_OF_STATES_D2));
+
+	// The metrics are below 32768 so the signed operations are safe
+	__m128i m0 = _mm_adds_epi16(lo, metric);
+	__m128i m1 = _mm_adds_epi16(hi, inverse);
+	__m128i even  = _mm_min_epi16(m0, m1);
+	__m128i evenD = _mm_cmpgt_epi16(m1, m0);
+
+	m0 = _mm_adds_epi16(lo, inverse);
+	m1 = _mm_adds_epi16(hi, metric);
+	__m128i odd  = _mm_min_epi16(m0, m1);
+	__m128i oddD = _mm_cmpgt_epi16(m1, m0);
+
+	_mm_store_si128((__m128i*)(newMetrics + 0U),                _mm_unpacklo_epi16(even, odd));
+	_mm_store_si128((__m128i*)(newMetrics + NUM_OF_STATES_D2), _mm_unpackhi_epi16(even, odd));
+
+	// The compares are set where the decision is 0
+	__m128i d = _mm_packs_epi16(_mm_unpacklo_epi16(evenD, oddD), _mm_unpackhi_epi16(evenD, oddD));
+
+	*decisions = uint64_t(~_mm_movemask_epi8(d) & 0xFFFF);
+}
+
+#elif defined(__ARM_NEON)
+
+const uint16_t BRANCH_TABLE1_16[] = {SOFT_ZERO, SOFT_ZERO, SOFT_ZERO, SOFT_ZERO, SOFT_ONE, SOFT_ONE, SOFT_ONE, SOFT_ONE};
+const uint16_t BRANCH_TABLE2_16[] = {SOFT_ZERO, SOFT_ONE, SOFT_ONE, SOFT_ZERO, SOFT_ZERO, SOFT_ONE, SOFT_ONE, SOFT_ZERO};
+const uint16_t DECISION_WEIGHTS[] = {0x01U, 0x02U, 0x04U, 0x08U, 0x10U, 0x20U, 0x40U, 0x80U};
+
+static inline uint64_t addAcross(uint16x8_t v)
+{
+	uint64x2_t sum = vpaddlq_u32(vpaddlq_u16(v));
+
+	return vgetq_lane_u64(sum, 0) + vgetq_lane_u64(sum, 1);
+}
+
+static void acsNEON(const uint16_t* oldMetrics, uint16_t* newMetrics, uint64_t* decisions, uint8_t s0, uint8_t s1)
+{
+	const uint16x8_t branch1 = vld1q_u16(BRANCH_TABLE1_16);
+	const uint16x8_t branch2 = vld1q_u16(BRANCH_TABLE2_16);
+	const uint16x8_t weights = vld1q_u16(DECISION_WEIGHTS);
+
+	uint16x8_t metric  = vaddq_u16(vabdq_u16(branch1, vdupq_n_u16(s0)), vabdq_u16(branch2, vdupq_n_u16(s1)));
+	uint16x8_t inverse = vsubq_u16(vdupq_n_u16(M), metric);
+
+	uint16x8_t lo = vld1q_u16(oldMetrics + 0U);
+	uint16x8_t hi = vld1q_u16(oldMetrics + NUM_OF_STATES_D2);
+
+	uint16x8_t m0 = vqaddq_u16(lo, metric);
+	uint16x8_t m1 = vqaddq_u16(hi, inverse);
+	uint16x8_t even  = vminq_u16(m0, m1);
+	uint16x8_t evenD = vcgeq_u16(m0, m1);
+
+	m0 = vqaddq_u16(lo, inverse);
+	m1 = vqaddq_u16(hi, metric);
+	uint16x8_t odd  = vminq_u16(m0, m1);
+	uint16x8_t oddD = vcgeq_u16(m0, m1);
+
+	uint16x8x2_t n = vzipq_u16(even, odd);
+	vst1q_u16(newMetrics + 0U,                n.val[0]);
+	vst1q_u16(newMetrics + NUM_OF_STATES_D2, n.val[1]);
+
+	uint16x8x2_t d = vzipq_u16(evenD, oddD);
+
+	*decisions = addAcross(vandq_u16(d.val[0], weights)) | (addAcross(vandq_u16(d.val[1], weights)) << 8);
+}
+
+#endif
+
+static ACS_KERNEL getSIMDKernel()
+{
+#if defined(__SSE2__)
+#if defined(__x86_64__)
+	return acsSSE2;
+#else
+	return __builtin_cpu_supports("sse2") ? acsSSE2 : NULL;
+#endif
+#elif defined(__ARM_NEON)
+#if defined(__aarch64__)
+	return acsNEON;
+#else
+	return (::getauxval(AT_HWCAP) & HWCAP_NEON) != 0U ? acsNEON : NULL;
+#endif
+#else
+	return NULL;
+#endif
+}
+
+static ACS_KERNEL selectKernel(bool simd)
+{
+	if (simd) {
+		ACS_KERNEL kernel = getSIMDKernel();
+		if (kernel != NULL)
+			return kernel;
+	}
+
+	return acsScalar;
+}
+
+static ACS_KERNEL acsKernel = selectKernel(true);
+
+const unsigned int LINK_SETUP_SYMBOLS = 488U;
+const unsigned int DATA_SYMBOLS       = 296U;
+
+// Where each depunctured symbol comes from in the received frame
+struct SYMBOL_SOURCE {
+	uint16_t m_bit;		// The received bit after the sync
+	uint8_t  m_byte;	// The received byte in the frame
+	uint8_t  m_mask;	// Zero for a fixed symbol
+	uint8_t  m_invert;	// 0xFF if the scrambler inverted the bit
+	uint8_t  m_clear;	// The symbol when the received bit is clear, or the fixed symbol
+	uint8_t  m_set;		// The symbol when the received bit is set
+};
+
+class CM17SymbolMap {
+public:
+	CM17SymbolMap(unsigned int nSymbols, unsigned int offset, unsigned int nBits, const unsigned int* puncture) :
+	m_symbols(),
+	m_nSymbols(nSymbols)
+	{
+		assert(nSymbols <= LINK_SETUP_SYMBOLS);
+		assert(puncture != NULL);
+
+		// Anything after the last received bit is a zero, as in decodeLinkSetup() and decodeData()
+		for (unsigned int i = 0U; i < nSymbols; i++) {
+			m_symbols[i].m_bit    = 0U;
+			m_symbols[i].m_byte   = 0U;
+			m_symbols[i].m_mask   = 0x00U;
+			m_symbols[i].m_invert = 0x00U;
+			m_symbols[i].m_clear  = SOFT_ZERO;
+			m_symbols[i].m_set    = SOFT_ZERO;
+		}
+
+		unsigned int n = 0U;
+		unsigned int index = 0U;
+		for (unsigned int i = 0U; i < nBits; i++) {
+			if (n == puncture[index]) {
+				m_symbols[n].m_clear = SOFT_ERASURE;
+				m_symbols[n].m_set   = SOFT_ERASURE;
+				n++;
+				index++;
+			}
+
+			unsigned int bit = CM17Interleaver::getSourceBit(offset + i);
+			unsigned int pos = bit + M17_SYNC_LENGTH_BITS;
+
+			m_symbols[n].m_bit    = bit;
+			m_symbols[n].m_byte   = pos / 8U;
+			m_symbols[n].m_mask   = BIT_MASK_TABLE[pos % 8U];
+			bool scrambled = CM17Interleaver::isScrambled(bit);
+			m_symbols[n].m_invert = scrambled ? 0xFFU : 0x00U;
+			m_symbols[n].m_clear  = scrambled ? SOFT_ONE : SOFT_ZERO;
+			m_symbols[n].m_set    = scrambled ? SOFT_ZERO : SOFT_ONE;
+			n++;
+		}
+	}
+
+	SYMBOL_SOURCE m_symbols[LINK_SETUP_SYMBOLS];
+	unsigned int  m_nSymbols;
+};
+
+static const CM17SymbolMap& getLinkSetupMap()
+{
+	static const CM17SymbolMap map(LINK_SETUP_SYMBOLS, 0U, M17_FRAME_LENGTH_BITS - M17_SYNC_LENGTH_BITS, PUNCTURE_LIST_LINK_SETUP);
+
+	return map;
+}
+
+static const CM17SymbolMap& getDataMap()
+{
+	static const CM17SymbolMap map(DATA_SYMBOLS, M17_LICH_FRAGMENT_FEC_LENGTH_BITS, M17_FRAME_LENGTH_BITS - M17_SYNC_LENGTH_BITS - M17_LICH_FRAGMENT_FEC_LENGTH_BITS, PUNCTURE_LIST_DATA);
+
+	return map;
+}
+
 CM17Convolution::CM17Convolution() :
-m_metrics1(NULL),
-m_metrics2(NULL),
+m_metrics1(),
+m_metrics2(),
 m_oldMetrics(NULL),
 m_newMetrics(NULL),
-m_decisions(NULL),
+m_decisions(),
 m_dp(NULL)
 {
-	m_metrics1  = new uint16_t[20U];
-	m_metrics2  = new uint16_t[20U];
-	m_decisions = new uint64_t[300U];
 }
 
 CM17Convolution::~CM17Convolution()
 {
-	delete[] m_metrics1;
-	delete[] m_metrics2;
-	delete[] m_decisions;
+}
+
+bool CM17Convolution::setSIMD(bool enabled)
+{
+	acsKernel = selectKernel(enabled);
+
+	return !enabled || acsKernel != acsScalar;
+}
+
+const char* CM17Convolution::getKernel()
+{
+	if (acsKernel == acsScalar)
+		return "scalar";
+
+#if defined(__SSE2__)
+	return "SSE2";
+#else
+	return "NEON";
+#endif
 }
 
 void CM17Convolution::encodeLinkSetup(const unsigned char* in, unsigned char* out) const
@@ -127,6 +383,30 @@ unsigned int CM17Convolution::decodeLinkSetup(const unsigned char* in, unsigned
 	assert(in != NULL);
 	assert(out != NULL);
 
+	uint8_t soft[368U];
+	for (unsigned int i = 0U; i < 368U; i++)
+		soft[i] = READ_BIT1(in, i) ? 0xFFU : 0x00U;
+
+	return decodeLinkSetupSoft(soft, out);
+}
+
+unsigned int CM17Convolution::decodeData(const unsigned char* in, unsigned char* out)
+{
+	assert(in != NULL);
+	assert(out != NULL);
+
+	uint8_t soft[272U];
+	for (unsigned int i = 0U; i < 272U; i++)
+		soft[i] = READ_BIT1(in, i) ? 0xFFU : 0x00U;
+
+	return decodeDataSoft(soft, out);
+}
+
+unsigned int CM17Convolution::decodeLinkSetupSoft(const uint8_t* in, unsigned char* out)
+{
+	assert(in != NULL);
+	assert(out != NULL);
+
 	uint8_t temp[500U];
 	::memset(temp, 0x00U, 500U);
 
@@ -134,12 +414,11 @@ unsigned int CM17Convolution::decodeLinkSetup(const unsigned char* in, unsigned
 	unsigned int index = 0U;
 	for (unsigned int i = 0U; i < 368U; i++) {
 		if (n == PUNCTURE_LIST_LINK_SETUP[index]) {
-			temp[n++] = 1U;
+			temp[n++] = SOFT_ERASURE;
 			index++;
 		}
 
-		bool b = READ_BIT1(in, i);
-		temp[n++] = b ? 2U : 0U;
+		temp[n++] = QUANTISE_SOFT(in[i]);
 	}
 
 	start();
@@ -155,7 +434,7 @@ unsigned int CM17Convolution::decodeLinkSetup(const unsigned char* in, unsigned
 	return chainback(out, 240U) - PUNCTURE_LIST_LINK_SETUP_COUNT;
 }
 
-unsigned int CM17Convolution::decodeData(const unsigned char* in, unsigned char* out)
+unsigned int CM17Convolution::decodeDataSoft(const uint8_t* in, unsigned char* out)
 {
 	assert(in != NULL);
 	assert(out != NULL);
@@ -167,12 +446,11 @@ unsigned int CM17Convolution::decodeData(const unsigned char* in, unsigned char*
 	unsigned int index = 0U;
 	for (unsigned int i = 0U; i < 272U; i++) {
 		if (n == PUNCTURE_LIST_DATA[index]) {
-			temp[n++] = 1U;
+			temp[n++] = SOFT_ERASURE;
 			index++;
 		}
 
-		bool b = READ_BIT1(in, i);
-		temp[n++] = b ? 2U : 0U;
+		temp[n++] = QUANTISE_SOFT(in[i]);
 	}
 
 	start();
@@ -188,6 +466,70 @@ unsigned int CM17Convolution::decodeData(const unsigned char* in, unsigned char*
 	return chainback(out, 144U) - PUNCTURE_LIST_DATA_COUNT;
 }
 
+unsigned int CM17Convolution::decodeLinkSetupFrame(const unsigned char* frame, unsigned char* out)
+{
+	assert(frame != NULL);
+	assert(out != NULL);
+
+	decodeFrame(getLinkSetupMap(), frame, NULL);
+
+	return chainback(out, 240U) - PUNCTURE_LIST_LINK_SETUP_COUNT;
+}
+
+unsigned int CM17Convolution::decodeDataFrame(const unsigned char* frame, unsigned char* out)
+{
+	assert(frame != NULL);
+	assert(out != NULL);
+
+	decodeFrame(getDataMap(), frame, NULL);
+
+	return chainback(out, 144U) - PUNCTURE_LIST_DATA_COUNT;
+}
+
+unsigned int CM17Convolution::decodeLinkSetupFrameSoft(const uint8_t* soft, unsigned char* out)
+{
+	assert(soft != NULL);
+	assert(out != NULL);
+
+	decodeFrame(getLinkSetupMap(), NULL, soft);
+
+	return chainback(out, 240U) - PUNCTURE_LIST_LINK_SETUP_COUNT;
+}
+
+unsigned int CM17Convolution::decodeDataFrameSoft(const uint8_t* soft, unsigned char* out)
+{
+	assert(soft != NULL);
+	assert(out != NULL);
+
+	decodeFrame(getDataMap(), NULL, soft);
+
+	return chainback(out, 144U) - PUNCTURE_LIST_DATA_COUNT;
+}
+
+void CM17Convolution::decodeFrame(const CM17SymbolMap& map, const unsigned char* frame, const uint8_t* soft)
+{
+	start();
+
+	const SYMBOL_SOURCE* p = map.m_symbols;
+
+	if (frame != NULL) {
+		for (unsigned int i = 0U; i < map.m_nSymbols; i += 2U, p += 2) {
+			// A fixed symbol has no mask bits so always reads as clear
+			uint8_t s0 = (frame[p[0].m_byte] & p[0].m_mask) != 0U ? p[0].m_set : p[0].m_clear;
+			uint8_t s1 = (frame[p[1].m_byte] & p[1].m_mask) != 0U ? p[1].m_set : p[1].m_clear;
+
+			decode(s0, s1);
+		}
+	} else {
+		for (unsigned int i = 0U; i < map.m_nSymbols; i += 2U, p += 2) {
+			uint8_t s0 = p[0].m_mask == 0x00U ? p[0].m_clear : QUANTISE_SOFT(soft[p[0].m_bit] ^ p[0].m_invert);
+			uint8_t s1 = p[1].m_mask == 0x00U ? p[1].m_clear : QUANTISE_SOFT(soft[p[1].m_bit] ^ p[1].m_invert);
+
+			decode(s0, s1);
+		}
+	}
+}
+
 void CM17Convolution::start()
 {
 	::memset(m_metrics1, 0x00U, NUM_OF_STATES * sizeof(uint16_t));
@@ -200,33 +542,15 @@ void CM17Convolution::start()
 
 void CM17Convolution::decode(uint8_t s0, uint8_t s1)
 {
-  *m_dp = 0U;
-
-  for (uint8_t i = 0U; i < NUM_OF_STATES_D2; i++) {
-    uint8_t j = i * 2U;
-
-    uint16_t metric = std::abs(BRANCH_TABLE1[i] - s0) + std::abs(BRANCH_TABLE2[i] - s1);
-
-    uint16_t m0 = m_oldMetrics[i] + metric;
-    uint16_t m1 = m_oldMetrics[i + NUM_OF_STATES_D2] + (M - metric);
-    uint8_t decision0 = (m0 >= m1) ? 1U : 0U;
-    m_newMetrics[j + 0U] = decision0 != 0U ? m1 : m0;
-
-    m0 = m_oldMetrics[i] + (M - metric);
-    m1 = m_oldMetrics[i + NUM_OF_STATES_D2] + metric;
-    uint8_t decision1 = (m0 >= m1) ? 1U : 0U;
-    m_newMetrics[j + 1U] = decision1 != 0U ? m1 : m0;
-
-    *m_dp |= (uint64_t(decision1) << (j + 1U)) | (uint64_t(decision0) << (j + 0U));
-  }
+	acsKernel(m_oldMetrics, m_newMetrics, m_dp, s0, s1);
 
-  ++m_dp;
+	++m_dp;
 
-  assert((m_dp - m_decisions) <= 300);
+	assert((m_dp - m_decisions) <= int(MAX_DECISIONS));
 
-  uint16_t* tmp = m_oldMetrics;
-  m_oldMetrics = m_newMetrics;
-  m_newMetrics = tmp;
+	uint16_t* tmp = m_oldMetrics;
+	m_oldMetrics = m_newMetrics;
+	m_newMetrics = tmp;
 }
 
 unsigned int CM17Convolution::chainback(unsigned char* out, unsigned int nBits)
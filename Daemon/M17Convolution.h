@@ -21,6 +21,8 @@
 
 #include <cstdint>
 
+class CM17SymbolMap;
+
 class CM17Convolution {
 public:
 	CM17Convolution();
@@ -29,20 +31,42 @@ public:
 	unsigned int decodeLinkSetup(const unsigned char* in, unsigned char* out);
 	unsigned int decodeData(const unsigned char* in, unsigned char* out);
 
+	// Soft decision input, one byte per bit, 0x00 is a certain 0, 0xFF is a certain 1,
+	// and 0x80 is unknown. The returned error count is weighted by the confidence.
+	unsigned int decodeLinkSetupSoft(const uint8_t* in, unsigned char* out);
+	unsigned int decodeDataSoft(const uint8_t* in, unsigned char* out);
+
+	// Decode straight from the received frame, sync included and still scrambled and
+	// interleaved, the depunctured symbols are read through a precomputed map
+	unsigned int decodeLinkSetupFrame(const unsigned char* frame, unsigned char* out);
+	unsigned int decodeDataFrame(const unsigned char* frame, unsigned char* out);
+
+	// As above with a confidence byte for each received bit after the sync
+	unsigned int decodeLinkSetupFrameSoft(const uint8_t* soft, unsigned char* out);
+	unsigned int decodeDataFrameSoft(const uint8_t* soft, unsigned char* out);
+
 	void encodeLinkSetup(const unsigned char* in, unsigned char* out) const;
 	void encodeData(const unsigned char* in, unsigned char* out) const;
 
+	// Choose between the SSE2/NEON add-compare-select kernel and the scalar one,
+	// returns false if the SIMD kernel was asked for but is not available
+	static bool setSIMD(bool enabled);
+
+	static const char* getKernel();
+
 private:
-	uint16_t* m_metrics1;
-	uint16_t* m_metrics2;
+	alignas(16) uint16_t m_metrics1[16U];
+	alignas(16) uint16_t m_metrics2[16U];
 	uint16_t* m_oldMetrics;
 	uint16_t* m_newMetrics;
-	uint64_t* m_decisions;
+	uint64_t  m_decisions[300U];
 	uint64_t* m_dp;
 
 	void start();
 	void decode(uint8_t s0, uint8_t s1);
 
+	void decodeFrame(const CM17SymbolMap& map, const unsigned char* frame, const uint8_t* soft);
+
 	unsigned int chainback(unsigned char* out, unsigned int nBits);
 
 	void encode(const unsigned char* in, unsigned char* out, unsigned int nBits) const;
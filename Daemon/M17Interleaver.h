@@ -0,0 +1,52 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(M17Interleaver_H)
+#define  M17Interleaver_H
+
+#include <cstdint>
+
+/*
+ * The M17 interleaver and decorrelator for the 368 bits that follow the sync.
+ * All of the frames passed in are complete 48 byte frames including the sync,
+ * the interleaver is its own inverse so the same call is used for TX and RX.
+ */
+class CM17Interleaver {
+public:
+	CM17Interleaver();
+	~CM17Interleaver();
+
+	// The sync is copied through unchanged, in and out must not overlap
+	static void interleave(const unsigned char* in, unsigned char* out);
+
+	// The sync is not scrambled, in and out may be the same
+	static void decorrelate(const unsigned char* in, unsigned char* out);
+
+	// Descramble and deinterleave only the first bytes after the sync, as used for the LICH
+	static void decodeStart(const unsigned char* in, unsigned char* out, unsigned int nBytes);
+
+	// For bit n after the sync once deinterleaved, the bit after the sync it was received as
+	static unsigned int getSourceBit(unsigned int n);
+
+	// Whether bit n after the sync is inverted by the scrambler
+	static bool isScrambled(unsigned int n);
+
+private:
+};
+
+#endif
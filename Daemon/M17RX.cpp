@@ -12,7 +12,10 @@
  */
 
 #include "M17RX.h"
+#include "PolyphaseResampler.h"
+#include "SRCResampler.h"
 #include "M17Convolution.h"
+#include "M17Interleaver.h"
 #include "Golay24128.h"
 #include "M17Utils.h"
 #include "M17CRC.h"
@@ -37,42 +40,14 @@ const unsigned int  BLEEP_FREQ   = 2000U;
 const unsigned int  BLEEP_LENGTH = 100U;
 const float         BLEEP_AMPL   = 0.1F;
 
-const unsigned int INTERLEAVER[] = {
-	0U, 137U, 90U, 227U, 180U, 317U, 270U, 39U, 360U, 129U, 82U, 219U, 172U, 309U, 262U, 31U, 352U, 121U, 74U, 211U, 164U,
-	301U, 254U, 23U, 344U, 113U, 66U, 203U, 156U, 293U, 246U, 15U, 336U, 105U, 58U, 195U, 148U, 285U, 238U, 7U, 328U, 97U,
-	50U, 187U, 140U, 277U, 230U, 367U, 320U, 89U, 42U, 179U, 132U, 269U, 222U, 359U, 312U, 81U, 34U, 171U, 124U, 261U, 214U,
-	351U, 304U, 73U, 26U, 163U, 116U, 253U, 206U, 343U, 296U, 65U, 18U, 155U, 108U, 245U, 198U, 335U, 288U, 57U, 10U, 147U,
-	100U, 237U, 190U, 327U, 280U, 49U, 2U, 139U, 92U, 229U, 182U, 319U, 272U, 41U, 362U, 131U, 84U, 221U, 174U, 311U, 264U,
-	33U, 354U, 123U, 76U, 213U, 166U, 303U, 256U, 25U, 346U, 115U, 68U, 205U, 158U, 295U, 248U, 17U, 338U, 107U, 60U, 197U,
-	150U, 287U, 240U, 9U, 330U, 99U, 52U, 189U, 142U, 279U, 232U, 1U, 322U, 91U, 44U, 181U, 134U, 271U, 224U, 361U, 314U, 83U,
-	36U, 173U, 126U, 263U, 216U, 353U, 306U, 75U, 28U, 165U, 118U, 255U, 208U, 345U, 298U, 67U, 20U, 157U, 110U, 247U, 200U,
-	337U, 290U, 59U, 12U, 149U, 102U, 239U, 192U, 329U, 282U, 51U, 4U, 141U, 94U, 231U, 184U, 321U, 274U, 43U, 364U, 133U, 86U,
-	223U, 176U, 313U, 266U, 35U, 356U, 125U, 78U, 215U, 168U, 305U, 258U, 27U, 348U, 117U, 70U, 207U, 160U, 297U, 250U, 19U,
-	340U, 109U, 62U, 199U, 152U, 289U, 242U, 11U, 332U, 101U, 54U, 191U, 144U, 281U, 234U, 3U, 324U, 93U, 46U, 183U, 136U, 273U,
-	226U, 363U, 316U, 85U, 38U, 175U, 128U, 265U, 218U, 355U, 308U, 77U, 30U, 167U, 120U, 257U, 210U, 347U, 300U, 69U, 22U,
-	159U, 112U, 249U, 202U, 339U, 292U, 61U, 14U, 151U, 104U, 241U, 194U, 331U, 284U, 53U, 6U, 143U, 96U, 233U, 186U, 323U,
-	276U, 45U, 366U, 135U, 88U, 225U, 178U, 315U, 268U, 37U, 358U, 127U, 80U, 217U, 170U, 307U, 260U, 29U, 350U, 119U, 72U,
-	209U, 162U, 299U, 252U, 21U, 342U, 111U, 64U, 201U, 154U, 291U, 244U, 13U, 334U, 103U, 56U, 193U, 146U, 283U, 236U, 5U,
-	326U, 95U, 48U, 185U, 138U, 275U, 228U, 365U, 318U, 87U, 40U, 177U, 130U, 267U, 220U, 357U, 310U, 79U, 32U, 169U, 122U,
-	259U, 212U, 349U, 302U, 71U, 24U, 161U, 114U, 251U, 204U, 341U, 294U, 63U, 16U, 153U, 106U, 243U, 196U, 333U, 286U, 55U,
-	8U, 145U, 98U, 235U, 188U, 325U, 278U, 47U};
-
-const unsigned char SCRAMBLER[] = {
-	0x00U, 0x00U, 0xD6U, 0xB5U, 0xE2U, 0x30U, 0x82U, 0xFFU, 0x84U, 0x62U, 0xBAU, 0x4EU, 0x96U, 0x90U, 0xD8U, 0x98U, 0xDDU,
-	0x5DU, 0x0CU, 0xC8U, 0x52U, 0x43U, 0x91U, 0x1DU, 0xF8U, 0x6EU, 0x68U, 0x2FU, 0x35U, 0xDAU, 0x14U, 0xEAU, 0xCDU, 0x76U,
-	0x19U, 0x8DU, 0xD5U, 0x80U, 0xD1U, 0x33U, 0x87U, 0x13U, 0x57U, 0x18U, 0x2DU, 0x29U, 0x78U, 0xC3U};
-
-const unsigned char BIT_MASK_TABLE[] = { 0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04U, 0x02U, 0x01U };
-
-#define WRITE_BIT(p,i,b) p[(i)>>3] = (b) ? (p[(i)>>3] | BIT_MASK_TABLE[(i)&7]) : (p[(i)>>3] & ~BIT_MASK_TABLE[(i)&7])
-#define READ_BIT(p,i)    (p[(i)>>3] & BIT_MASK_TABLE[(i)&7])
-
-CM17RX::CM17RX(const std::string& callsign, CRSSIInterpolator* rssiMapper, bool bleep, CCodec2& codec3200, CCodec2& codec1600) :
+CM17RX::CM17RX(const std::string& callsign, CRSSIInterpolator* rssiMapper, bool bleep, CCodec2Decoder& codec3200, CCodec2Decoder& codec1600, unsigned int sampleRate, RESAMPLER_TYPE resampler) :
 m_3200(codec3200),
 m_1600(codec1600),
 m_callsign(callsign),
 m_bleep(bleep),
 m_volume(1.0F),
+m_sampleRate(sampleRate),
+m_blockSize(sampleRate / 25U),
 m_callback(NULL),
 m_state(RS_RF_LISTENING),
 m_frames(0U),
@@ -83,7 +58,8 @@ m_running(),
 m_textBitMap(0x00U),
 m_text(NULL),
 m_callsigns(),
-m_queue(25000U, "M17 RX Audio"),
+m_queue((25000U * sampleRate) / SOUNDCARD_SAMPLE_RATE, "M17 RX Audio"),
+m_conv(),
 m_rssiMapper(rssiMapper),
 m_rssi(0U),
 m_maxRSSI(0U),
@@ -91,20 +67,27 @@ m_minRSSI(0U),
 m_aveRSSI(0U),
 m_rssiCount(0U),
 m_resampler(NULL),
-m_error(0),
 m_latitude(),
 m_longitude()
 {
+	assert(sampleRate >= CODEC_SAMPLE_RATE && sampleRate <= SOUNDCARD_SAMPLE_RATE);
+
 	m_text = new char[4U * M17_META_LENGTH_BYTES];
 
-	m_resampler = ::src_new(SRC_SINC_FASTEST, 1, &m_error);
+	// At the codec rate the decoded audio is queued as it is
+	if (sampleRate != CODEC_SAMPLE_RATE) {
+		if (resampler == RT_SRC)
+			m_resampler = new CSRCResampler(CODEC_SAMPLE_RATE, sampleRate);
+		else
+			m_resampler = new CPolyphaseResampler(CODEC_SAMPLE_RATE, sampleRate);
+	}
 }
 
 CM17RX::~CM17RX()
 {
 	delete[] m_text;
 
-	::src_delete(m_resampler);
+	delete m_resampler;
 }
 
 void CM17RX::setStatusCallback(IStatusCallback* callback)
@@ -156,7 +139,7 @@ unsigned int CM17RX::read(float* audio, unsigned int len)
 	return len;
 }
 
-bool CM17RX::write(unsigned char* data, unsigned int len)
+bool CM17RX::write(unsigned char* data, unsigned int len, const uint8_t* soft)
 {
 	assert(data != NULL);
 	assert(len > 0U);
@@ -211,16 +194,20 @@ bool CM17RX::write(unsigned char* data, unsigned int len)
 		m_rssiCount++;
 	}
 
-	unsigned char temp[M17_FRAME_LENGTH_BYTES];
-	decorrelator(data + 2U, temp);
-	interleaver(temp, data + 2U);
+	// Only the LICH is descrambled and deinterleaved here, the convolutional code is decoded straight from the frame
+	unsigned char fragment[M17_LICH_FRAGMENT_FEC_LENGTH_BYTES];
+	if (data[0U] == TAG_DATA)
+		CM17Interleaver::decodeStart(data + 2U, fragment, M17_LICH_FRAGMENT_FEC_LENGTH_BYTES);
 
 	if (m_state == RS_RF_LISTENING && data[0U] == TAG_HEADER) {
 		m_lsf.reset();
 
-		CM17Convolution conv;
 		unsigned char frame[M17_LSF_LENGTH_BYTES];
-		unsigned int ber = conv.decodeLinkSetup(data + 2U + M17_SYNC_LENGTH_BYTES, frame);
+		unsigned int ber;
+		if (soft != NULL)
+			ber = m_conv.decodeLinkSetupFrameSoft(soft, frame);
+		else
+			ber = m_conv.decodeLinkSetupFrame(data + 2U, frame);
 
 		bool valid = CM17CRC::checkCRC16(frame, M17_LSF_LENGTH_BYTES);
 		if (valid) {
@@ -232,10 +219,10 @@ bool CM17RX::write(unsigned char* data, unsigned int len)
 				return false;
 			}
 
-			if (m_callback != NULL) {
+			if (m_callback != NULL)
 				m_callback->statusCallback(m_lsf.getSource(), m_lsf.getDest(), false);
-				processLSF(m_lsf);
-			}
+
+			processLSF(m_lsf);
 
 			m_running.reset();
 			m_frames     = 0U;
@@ -266,22 +253,19 @@ bool CM17RX::write(unsigned char* data, unsigned int len)
 	}
 
 	if (m_state == RS_RF_LATE_ENTRY && data[0U] == TAG_DATA) {
-		unsigned int lich1, lich2, lich3, lich4;
-		bool valid1 = CGolay24128::decode24128(data + 2U + M17_SYNC_LENGTH_BYTES + 0U, lich1);
-		bool valid2 = CGolay24128::decode24128(data + 2U + M17_SYNC_LENGTH_BYTES + 3U, lich2);
-		bool valid3 = CGolay24128::decode24128(data + 2U + M17_SYNC_LENGTH_BYTES + 6U, lich3);
-		bool valid4 = CGolay24128::decode24128(data + 2U + M17_SYNC_LENGTH_BYTES + 9U, lich4);
-
-		if (!valid1 || !valid2 || !valid3 || !valid4)
+		uint32_t lichs[4U];
+		unsigned int errs[4U];
+		bool valid = CGolay24128::decode24128x4(fragment, lichs, errs);
+		if (!valid)
 			return false;
 
 		unsigned char lich[M17_LICH_FRAGMENT_LENGTH_BYTES];
-		CM17Utils::combineFragmentLICH(lich1, lich2, lich3, lich4, lich);
+		CM17Utils::combineFragmentLICH(lichs[0U], lichs[1U], lichs[2U], lichs[3U], lich);
 
-		unsigned int n = (lich4 >> 5) & 0x07U;
+		unsigned int n = (lichs[3U] >> 5) & 0x07U;
 		m_lsf.setFragment(lich, n);
 
-		bool valid = m_lsf.isValid();
+		valid = m_lsf.isValid();
 		if (valid) {
 			bool ret = processHeader(true);
 			if (!ret) {
@@ -289,15 +273,15 @@ bool CM17RX::write(unsigned char* data, unsigned int len)
 				return false;
 			}
 
-			if (m_callback != NULL) {
+			if (m_callback != NULL)
 				m_callback->statusCallback(m_lsf.getSource(), m_lsf.getDest(), false);
-				processLSF(m_lsf);
-			}
+
+			processLSF(m_lsf);
 
 			m_running.reset();
 			m_frames     = 0U;
 			m_errs       = 0U;
-			m_bits       = 1U;
+			m_bits       = 0U;
 			m_minRSSI    = m_rssi;
 			m_maxRSSI    = m_rssi;
 			m_aveRSSI    = m_rssi;
@@ -315,11 +299,14 @@ bool CM17RX::write(unsigned char* data, unsigned int len)
 	}
 
 	if ((m_state == RS_RF_AUDIO || m_state == RS_RF_AUDIO_DATA) && data[0U] == TAG_DATA) {
-		processRunningLSF(data + 2U + M17_SYNC_LENGTH_BYTES);
+		processRunningLSF(fragment);
 
-		CM17Convolution conv;
 		unsigned char frame[M17_FN_LENGTH_BYTES + M17_PAYLOAD_LENGTH_BYTES];
-		unsigned int ber = conv.decodeData(data + 2U + M17_SYNC_LENGTH_BYTES + M17_LICH_FRAGMENT_FEC_LENGTH_BYTES, frame);
+		unsigned int ber;
+		if (soft != NULL)
+			ber = m_conv.decodeDataFrameSoft(soft, frame);
+		else
+			ber = m_conv.decodeDataFrame(data + 2U, frame);
 
 		uint16_t fn = (frame[0U] << 8) + (frame[1U] << 0);
 
@@ -344,21 +331,14 @@ bool CM17RX::write(unsigned char* data, unsigned int len)
 		for (unsigned int i = 0U; i < CODEC_BLOCK_SIZE; i++)
 			f8000[i] = (float(audio[i]) * m_volume) / 32768.0F;
 
-		float f48000[SOUNDCARD_BLOCK_SIZE];
+		if (m_resampler != NULL) {
+			float block[SOUNDCARD_BLOCK_SIZE];
+			m_resampler->process(f8000, CODEC_BLOCK_SIZE, block, m_blockSize);
 
-		SRC_DATA data;
-		data.data_in       = f8000;
-		data.data_out      = f48000;
-		data.input_frames  = CODEC_BLOCK_SIZE;
-		data.output_frames = SOUNDCARD_BLOCK_SIZE;
-		data.end_of_input  = 0;
-		data.src_ratio     = double(SOUNDCARD_SAMPLE_RATE) / double(CODEC_SAMPLE_RATE);
-
-		int ret = ::src_process(m_resampler, &data);
-		if (ret != 0)
-			LogError("Error from the RX resampler - %d - %s", ret, ::src_strerror(ret));
-
-		writeQueue(f48000, SOUNDCARD_BLOCK_SIZE);
+			writeQueue(block, m_blockSize);
+		} else {
+			writeQueue(f8000, CODEC_BLOCK_SIZE);
+		}
 
 		m_frames++;
 
@@ -404,12 +384,6 @@ void CM17RX::writeQueue(const float *audio, unsigned int len)
 	assert(audio != NULL);
 	assert(len > 0U);
 
-	unsigned int space = m_queue.freeSpace();
-	if (space < len) {
-		LogError("Overflow in the M17 RX queue");
-		return;
-	}
-
 	m_queue.addData(audio, len);
 }
 
@@ -447,28 +421,6 @@ bool CM17RX::processHeader(bool lateEntry)
 	return true;
 }
 
-void CM17RX::interleaver(const unsigned char* in, unsigned char* out) const
-{
-	assert(in != NULL);
-	assert(out != NULL);
-
-	for (unsigned int i = 0U; i < (M17_FRAME_LENGTH_BITS - M17_SYNC_LENGTH_BITS); i++) {
-		unsigned int n1 = i + M17_SYNC_LENGTH_BITS;
-		bool b = READ_BIT(in, n1) != 0U;
-		unsigned int n2 = INTERLEAVER[i] + M17_SYNC_LENGTH_BITS;
-		WRITE_BIT(out, n2, b);
-	}
-}
-
-void CM17RX::decorrelator(const unsigned char* in, unsigned char* out) const
-{
-	assert(in != NULL);
-	assert(out != NULL);
-
-	for (unsigned int i = M17_SYNC_LENGTH_BYTES; i < M17_FRAME_LENGTH_BYTES; i++)
-		out[i] = in[i] ^ SCRAMBLER[i];
-}
-
 void CM17RX::processLSF(const CM17LSF& lsf)
 {
 	if (lsf.getEncryptionType() == M17_ENCRYPTION_TYPE_NONE) {
@@ -500,7 +452,8 @@ void CM17RX::processLSF(const CM17LSF& lsf)
 
 						if (m_textBitMap == 0x11U || m_textBitMap == 0x33U || m_textBitMap == 0x77U || m_textBitMap == 0xFFU) {
 							LogMessage("Text Data: \"%s\"", m_text);
-							m_callback->textCallback(m_text);
+							if (m_callback != NULL)
+								m_callback->textCallback(m_text);
 						}
 					}
 				}
@@ -550,7 +503,8 @@ void CM17RX::processLSF(const CM17LSF& lsf)
 					if (m_latitude && m_longitude)
 						calcBD(m_latitude, m_longitude, latitude, longitude, bearing, distance);
 
-					m_callback->gpsCallback(latitude, longitude, locator, altitude, speed, track, bearing, distance);
+					if (m_callback != NULL)
+						m_callback->gpsCallback(latitude, longitude, locator, altitude, speed, track, bearing, distance);
 				}
 				break;
 
@@ -569,7 +523,8 @@ void CM17RX::processLSF(const CM17LSF& lsf)
 
 					LogMessage("Extra Callsign Data: %s", m_callsigns.c_str());
 
-					m_callback->callsignsCallback(m_callsigns.c_str());
+					if (m_callback != NULL)
+						m_callback->callsignsCallback(m_callsigns.c_str());
 				}
 				break;
 
@@ -599,22 +554,24 @@ void CM17RX::processLSF(const CM17LSF& lsf)
 
 void CM17RX::processRunningLSF(const unsigned char* fragment)
 {
-	unsigned int lich1, lich2, lich3, lich4;
-	bool valid1 = CGolay24128::decode24128((unsigned char *)(fragment + 0U), lich1);
-	bool valid2 = CGolay24128::decode24128((unsigned char *)(fragment + 3U), lich2);
-	bool valid3 = CGolay24128::decode24128((unsigned char *)(fragment + 6U), lich3);
-	bool valid4 = CGolay24128::decode24128((unsigned char *)(fragment + 9U), lich4);
+	uint32_t lichs[4U];
+	unsigned int errs[4U];
+	bool valid = CGolay24128::decode24128x4(fragment, lichs, errs);
+
+	// The LICH counts towards the BER as well as the payload
+	m_bits += M17_LICH_FRAGMENT_FEC_LENGTH_BITS;
+	m_errs += errs[0U] + errs[1U] + errs[2U] + errs[3U];
 
-	if (!valid1 || !valid2 || !valid3 || !valid4)
+	if (!valid)
 		return;
 
 	unsigned char lich[M17_LICH_FRAGMENT_LENGTH_BYTES];
-	CM17Utils::combineFragmentLICH(lich1, lich2, lich3, lich4, lich);
+	CM17Utils::combineFragmentLICH(lichs[0U], lichs[1U], lichs[2U], lichs[3U], lich);
 
-	unsigned int n = (lich4 >> 5) & 0x07U;
+	unsigned int n = (lichs[3U] >> 5) & 0x07U;
 	m_running.setFragment(lich, n);
 
-	bool valid = m_running.isValid();
+	valid = m_running.isValid();
 	if (valid) {
 		processLSF(m_running);
 		m_running.reset();
@@ -623,12 +580,12 @@ void CM17RX::processRunningLSF(const unsigned char* fragment)
 
 void CM17RX::addBleep()
 {
-	const unsigned int length = SOUNDCARD_SAMPLE_RATE / BLEEP_FREQ;
-	const unsigned int total  = (SOUNDCARD_SAMPLE_RATE * BLEEP_LENGTH) / 1000U;
+	const unsigned int length = m_sampleRate / BLEEP_FREQ;
+	const unsigned int total  = (m_sampleRate * BLEEP_LENGTH) / 1000U;
 
 	float step = (2.0F * M_PI) / float(length);
 
-	float audio[total];
+	float audio[(SOUNDCARD_SAMPLE_RATE * BLEEP_LENGTH) / 1000U];
 
 	for (unsigned int i = 0U; i < total; i++)
 		audio[i] = ::sinf(float(i) * step) * BLEEP_AMPL * m_volume;
@@ -648,12 +605,10 @@ void CM17RX::addEnd()
 
 void CM17RX::addSilence(unsigned int n)
 {
-	const float SILENCE = 0.0F;
+	static const float SILENCE[SOUNDCARD_BLOCK_SIZE] = { 0.0F };
 
-	for (unsigned int i = 0U; i < n; i++) {
-		for (unsigned int j = 0U; j < SOUNDCARD_BLOCK_SIZE; j++)
-			writeQueue(&SILENCE, 1U);
-	}
+	for (unsigned int i = 0U; i < n; i++)
+		writeQueue(SILENCE, m_blockSize);
 }
 
 void CM17RX::calcBD(const std::optional<float>& srcLat, const std::optional<float>& srcLon,
@@ -21,21 +21,22 @@
 
 #include "RSSIInterpolator.h"
 #include "StatusCallback.h"
+#include "M17Convolution.h"
 #include "codec2/codec2.h"
-#include "RingBuffer.h"
+#include "SPSCRingBuffer.h"
 #include "M17Defines.h"
 #include "Defines.h"
+#include "Resampler.h"
 #include "M17LSF.h"
 #include "Modem.h"
 
-#include <samplerate.h>
-
 #include <string>
 #include <optional>
 
 class CM17RX {
 public:
-	CM17RX(const std::string& callsign, CRSSIInterpolator* rssiMapper, bool bleep, CCodec2& codec3200, CCodec2& codec1600);
+	CM17RX(const std::string& callsign, CRSSIInterpolator* rssiMapper, bool bleep, CCodec2Decoder& codec3200, CCodec2Decoder& codec1600,
+		unsigned int sampleRate = SOUNDCARD_SAMPLE_RATE, RESAMPLER_TYPE resampler = RT_POLYPHASE);
 	~CM17RX();
 
 	void setStatusCallback(IStatusCallback* callback);
@@ -46,16 +47,20 @@ public:
 
 	void setGPS(float latitude, float longitude);
 
-	bool write(unsigned char* data, unsigned int len);
+	// The optional soft data holds a confidence byte for each of the bits after the sync,
+	// in the order received, 0x00 is a certain 0 and 0xFF a certain 1
+	bool write(unsigned char* data, unsigned int len, const uint8_t* soft = NULL);
 
 	unsigned int read(float* audio, unsigned int len);
 
 private:
-	CCodec2&             m_3200;
-	CCodec2&             m_1600;
+	CCodec2Decoder&      m_3200;
+	CCodec2Decoder&      m_1600;
 	std::string          m_callsign;
 	bool                 m_bleep;
 	float                m_volume;
+	unsigned int         m_sampleRate;
+	unsigned int         m_blockSize;
 	IStatusCallback*     m_callback;
 	RPT_RF_STATE         m_state;
 	unsigned int         m_frames;
@@ -66,15 +71,15 @@ private:
 	uint8_t              m_textBitMap;
 	char*                m_text;
 	std::string          m_callsigns;
-	CRingBuffer<float>   m_queue;
+	CSPSCRingBuffer<float> m_queue;
+	CM17Convolution      m_conv;
 	CRSSIInterpolator*   m_rssiMapper;
 	unsigned char        m_rssi;
 	unsigned char        m_maxRSSI;
 	unsigned char        m_minRSSI;
 	unsigned int         m_aveRSSI;
 	unsigned int         m_rssiCount;
-	SRC_STATE*           m_resampler;
-	int                  m_error;
+	IResampler*          m_resampler;
 	std::optional<float> m_latitude;
 	std::optional<float> m_longitude;
 
@@ -82,9 +87,6 @@ private:
 
 	bool processHeader(bool lateEntry);
 
-	void interleaver(const unsigned char* in, unsigned char* out) const;
-	void decorrelator(const unsigned char* in, unsigned char* out) const;
-
 	void processRunningLSF(const unsigned char* fragment);
 	void processLSF(const CM17LSF& lsf);
 
@@ -0,0 +1,297 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "M17Replay.h"
+#include "ModemCapture.h"
+#include "StopWatch.h"
+#include "Defines.h"
+#include "Log.h"
+
+#include <cassert>
+#include <cstring>
+
+const unsigned int WAV_HEADER_LENGTH = 44U;
+
+const unsigned int MAX_RECORD_LENGTH = 255U;
+
+// The MMDVM frames received from the modem, as in Modem.cpp
+const unsigned char MMDVM_FRAME_START     = 0xE0U;
+const unsigned char MMDVM_M17_LINK_SETUP  = 0x45U;
+const unsigned char MMDVM_M17_STREAM      = 0x46U;
+const unsigned char MMDVM_M17_LOST        = 0x48U;
+const unsigned char MMDVM_M17_EOT         = 0x49U;
+
+const unsigned int MAX_CAPTURE_LENGTH = 1024U;
+
+static void writeLE(unsigned char* p, unsigned int value, unsigned int n)
+{
+	for (unsigned int i = 0U; i < n; i++)
+		p[i] = (value >> (i * 8U)) & 0xFFU;
+}
+
+CM17Replay::CM17Replay(const std::string& frameFile, const std::string& wavFile) :
+m_frameFile(frameFile),
+m_wavFile(wavFile),
+m_3200(true),
+m_1600(false),
+m_rssi(),
+m_rx(std::string(), &m_rssi, false, m_3200, m_1600),
+m_wav(NULL),
+m_samples(0U)
+{
+	assert(!frameFile.empty());
+	assert(!wavFile.empty());
+
+	m_rx.setVolume(100U);
+}
+
+CM17Replay::~CM17Replay()
+{
+}
+
+int CM17Replay::run()
+{
+	if (!openWAV())
+		return 1;
+
+	unsigned int frames = 0U;
+
+	CStopWatch stopWatch;
+	stopWatch.start();
+
+	bool ret;
+	if (CModemCapture::isCapture(m_frameFile))
+		ret = replayCapture(frames);
+	else
+		ret = replayFrames(frames);
+
+	unsigned int ms = stopWatch.elapsed();
+
+	closeWAV();
+
+	if (!ret)
+		return 1;
+
+	float secs = float(ms) / 1000.0F;
+	if (ms == 0U)
+		secs = 0.001F;
+
+	LogMessage("Replayed %u frames in %.3f seconds, %.0f frames/s, %.1f seconds of audio written to %s", frames, secs, float(frames) / secs, float(m_samples) / float(SOUNDCARD_SAMPLE_RATE), m_wavFile.c_str());
+
+	return 0;
+}
+
+bool CM17Replay::replayFrames(unsigned int& frames)
+{
+	FILE* fp = ::fopen(m_frameFile.c_str(), "rb");
+	if (fp == NULL) {
+		LogError("Cannot open the frame file %s", m_frameFile.c_str());
+		return false;
+	}
+
+	for (unsigned int record = 0U;; record++) {
+		int len = ::fgetc(fp);
+		if (len == EOF)
+			break;
+
+		if (len == 0) {
+			LogWarning("Zero length record after %u frames, ignoring", frames);
+			continue;
+		}
+
+		unsigned char data[MAX_RECORD_LENGTH];
+		if (::fread(data, 1U, len, fp) != (size_t)len) {
+			LogWarning("Truncated record after %u frames, stopping", frames);
+			break;
+		}
+
+		if (!checkRecord(data, len, record))
+			continue;
+
+		writeFrame(data, len);
+		frames++;
+	}
+
+	::fclose(fp);
+
+	return true;
+}
+
+bool CM17Replay::replayCapture(unsigned int& frames)
+{
+	CModemCapture capture(m_frameFile, 0U);
+	if (!capture.openRead())
+		return false;
+
+	CAPTURE_DIRECTION direction;
+	uint64_t timestamp;
+	unsigned char buffer[MAX_CAPTURE_LENGTH];
+	unsigned int length;
+
+	for (unsigned int record = 0U; capture.read(direction, timestamp, buffer, length); record++) {
+		if (direction != CD_RX || length < 3U || buffer[0U] != MMDVM_FRAME_START)
+			continue;
+
+		// The tag replaces the frame start and length, as in CModem::clock()
+		unsigned char data[MAX_RECORD_LENGTH];
+		unsigned int len = 0U;
+
+		switch (buffer[2U]) {
+			case MMDVM_M17_LINK_SETUP:
+			case MMDVM_M17_STREAM:
+				if ((length - 3U) >= MAX_RECORD_LENGTH) {
+					LogWarning("Record %u is %u bytes long, ignoring", record, length);
+					continue;
+				}
+				data[0U] = buffer[2U] == MMDVM_M17_LINK_SETUP ? TAG_HEADER : TAG_DATA;
+				::memcpy(data + 1U, buffer + 3U, length - 3U);
+				len = length - 2U;
+				break;
+			case MMDVM_M17_LOST:
+				data[0U] = TAG_LOST;
+				len = 1U;
+				break;
+			case MMDVM_M17_EOT:
+				data[0U] = TAG_EOT;
+				len = 1U;
+				break;
+			default:
+				continue;
+		}
+
+		if (!checkRecord(data, len, record))
+			continue;
+
+		writeFrame(data, len);
+		frames++;
+	}
+
+	capture.close();
+
+	return true;
+}
+
+bool CM17Replay::checkRecord(const unsigned char* data, unsigned int length, unsigned int record) const
+{
+	assert(data != NULL);
+	assert(length > 0U);
+
+	// A short frame would otherwise be decoded with the tail of the one before it
+	switch (data[0U]) {
+		case TAG_HEADER:
+		case TAG_DATA:
+			if (length == (M17_FRAME_LENGTH_BYTES + 2U) || length == (M17_FRAME_LENGTH_BYTES + 4U))
+				return true;
+
+			LogWarning("Record %u is a %s of %u bytes, not %u or %u, ignoring", record, data[0U] == TAG_HEADER ? "header" : "data frame", length,
+				M17_FRAME_LENGTH_BYTES + 2U, M17_FRAME_LENGTH_BYTES + 4U);
+			return false;
+
+		case TAG_LOST:
+		case TAG_EOT:
+			return true;
+
+		default:
+			LogWarning("Record %u has an unknown tag 0x%02X, ignoring", record, data[0U]);
+			return false;
+	}
+}
+
+void CM17Replay::writeFrame(unsigned char* data, unsigned int length)
+{
+	assert(data != NULL);
+	assert(length > 0U);
+
+	m_rx.write(data, length);
+
+	writeAudio();
+}
+
+bool CM17Replay::openWAV()
+{
+	m_wav = ::fopen(m_wavFile.c_str(), "wb");
+	if (m_wav == NULL) {
+		LogError("Cannot open the WAV file %s", m_wavFile.c_str());
+		return false;
+	}
+
+	// The sizes are filled in by closeWAV()
+	unsigned char header[WAV_HEADER_LENGTH];
+	::memcpy(header + 0U, "RIFF", 4U);
+	writeLE(header + 4U, 0U, 4U);
+	::memcpy(header + 8U, "WAVEfmt ", 8U);
+	writeLE(header + 16U, 16U, 4U);
+	writeLE(header + 20U, 1U, 2U);				// PCM
+	writeLE(header + 22U, 1U, 2U);				// Mono
+	writeLE(header + 24U, SOUNDCARD_SAMPLE_RATE, 4U);
+	writeLE(header + 28U, SOUNDCARD_SAMPLE_RATE * 2U, 4U);
+	writeLE(header + 32U, 2U, 2U);
+	writeLE(header + 34U, 16U, 2U);
+	::memcpy(header + 36U, "data", 4U);
+	writeLE(header + 40U, 0U, 4U);
+
+	::fwrite(header, 1U, WAV_HEADER_LENGTH, m_wav);
+
+	m_samples = 0U;
+
+	return true;
+}
+
+void CM17Replay::writeAudio()
+{
+	assert(m_wav != NULL);
+
+	float audio[SOUNDCARD_BLOCK_SIZE];
+	unsigned int n;
+	while ((n = m_rx.read(audio, SOUNDCARD_BLOCK_SIZE)) > 0U) {
+		unsigned char buffer[SOUNDCARD_BLOCK_SIZE * 2U];
+
+		for (unsigned int i = 0U; i < n; i++) {
+			float sample = audio[i];
+			if (sample > 1.0F)
+				sample = 1.0F;
+			else if (sample < -1.0F)
+				sample = -1.0F;
+
+			short value = short(sample * 32767.0F);
+			writeLE(buffer + i * 2U, (unsigned short)value, 2U);
+		}
+
+		::fwrite(buffer, 2U, n, m_wav);
+
+		m_samples += n;
+	}
+}
+
+void CM17Replay::closeWAV()
+{
+	assert(m_wav != NULL);
+
+	unsigned char size[4U];
+
+	writeLE(size, m_samples * 2U + WAV_HEADER_LENGTH - 8U, 4U);
+	::fseek(m_wav, 4L, SEEK_SET);
+	::fwrite(size, 1U, 4U, m_wav);
+
+	writeLE(size, m_samples * 2U, 4U);
+	::fseek(m_wav, 40L, SEEK_SET);
+	::fwrite(size, 1U, 4U, m_wav);
+
+	::fclose(m_wav);
+	m_wav = NULL;
+}
@@ -0,0 +1,72 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(M17Replay_H)
+#define	M17Replay_H
+
+#include "codec2/codec2.h"
+#include "RSSIInterpolator.h"
+#include "M17RX.h"
+
+#include <cstdio>
+#include <string>
+
+/*
+ * Drives CM17RX from a file of recorded frames instead of a modem, as fast as
+ * it will go, and writes the decoded audio to a 16-bit mono WAV file at the
+ * sound card rate. Each record in the frame file is a length byte followed by
+ * that many bytes, exactly as they are returned by CModem::readM17Data(): the
+ * tag, and for a header or data frame the control byte, the 48 byte frame and
+ * optionally two RSSI bytes.
+ *
+ * A capture file written by CModemCapture can be replayed too, the M17 frames
+ * received from the modem are converted as CModem would have done.
+ *
+ * Header and data records of any other length, and unknown tags, are logged
+ * and skipped.
+ */
+class CM17Replay {
+public:
+	CM17Replay(const std::string& frameFile, const std::string& wavFile);
+	~CM17Replay();
+
+	int run();
+
+private:
+	std::string       m_frameFile;
+	std::string       m_wavFile;
+	CCodec2Decoder    m_3200;
+	CCodec2Decoder    m_1600;
+	CRSSIInterpolator m_rssi;
+	CM17RX            m_rx;
+	FILE*             m_wav;
+	unsigned int      m_samples;
+
+	bool replayFrames(unsigned int& frames);
+	bool replayCapture(unsigned int& frames);
+
+	bool checkRecord(const unsigned char* data, unsigned int length, unsigned int record) const;
+
+	void writeFrame(unsigned char* data, unsigned int length);
+
+	bool openWAV();
+	void writeAudio();
+	void closeWAV();
+};
+
+#endif
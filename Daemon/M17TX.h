@@ -21,27 +21,28 @@
 
 #include "codec2/codec2.h"
 #include "M17Defines.h"
+#include "SPSCRingBuffer.h"
 #include "RingBuffer.h"
 #include "Defines.h"
+#include "Resampler.h"
 #include "M17LSF.h"
 #include "Modem.h"
 
-#include <samplerate.h>
-
+#include <atomic>
 #include <string>
 #include <vector>
 #include <optional>
 
 enum TX_STATUS {
 	TXS_NONE,
-	TXS_HEADER,
 	TXS_AUDIO,
 	TXS_END
 };
 
 class CM17TX {
 public:
-	CM17TX(const std::string& callsign, const std::string& text, unsigned int micGain, CCodec2& codec3200, CCodec2& codec1600);
+	CM17TX(const std::string& callsign, const std::string& text, unsigned int micGain, CCodec2Encoder& codec3200, CCodec2Encoder& codec1600,
+		unsigned int sampleRate = SOUNDCARD_SAMPLE_RATE, RESAMPLER_TYPE resampler = RT_POLYPHASE);
 	~CM17TX();
 
 	void setParams(unsigned int can, unsigned int mode);
@@ -66,15 +67,17 @@ public:
 	bool isTX() const;
 
 private:
-	CCodec2&                   m_3200;
-	CCodec2&                   m_1600;
+	CCodec2Encoder&            m_3200;
+	CCodec2Encoder&            m_1600;
 	unsigned int               m_mode;
 	std::string                m_source;
 	std::string                m_dest;
 	float                      m_micGain;
+	unsigned int               m_sampleRate;
+	unsigned int               m_blockSize;
 	unsigned int               m_can;
-	TX_STATUS                  m_status;
-	CRingBuffer<float>         m_audio;
+	std::atomic<TX_STATUS>     m_status;
+	CSPSCRingBuffer<float>     m_audio;
 	CRingBuffer<unsigned char> m_queue;
 	uint16_t                   m_frames;
 	CM17LSF*                   m_currLSF;
@@ -83,13 +86,13 @@ private:
 	bool                       m_sendingGPS;
 	CM17LSF*                   m_gpsLSF;
 	unsigned int               m_lsfN;
-	SRC_STATE*                 m_resampler;
-	int                        m_error;
+	IResampler*                m_resampler;
 
-	void writeQueue(const unsigned char* data);
+	void writeHeader();
+	void writeAudio(const short* audio);
+	void writeEOT();
 
-	void interleaver(const unsigned char* in, unsigned char* out) const;
-	void decorrelator(const unsigned char* in, unsigned char* out) const;
+	void writeQueue(const unsigned char* data);
 
 	void addLinkSetupSync(unsigned char* data);
 	void addStreamSync(unsigned char* data);
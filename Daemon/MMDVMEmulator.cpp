@@ -0,0 +1,771 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "MMDVMEmulator.h"
+#include "M17Defines.h"
+#include "Defines.h"
+#include "Log.h"
+
+#include <cassert>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <termios.h>
+#include <unistd.h>
+
+const unsigned char MMDVM_FRAME_START = 0xE0U;
+
+const unsigned char MMDVM_GET_VERSION = 0x00U;
+const unsigned char MMDVM_GET_STATUS  = 0x01U;
+
+const unsigned char MMDVM_SET_MODE    = 0x03U;
+
+const unsigned char MMDVM_M17_LINK_SETUP = 0x45U;
+const unsigned char MMDVM_M17_STREAM     = 0x46U;
+const unsigned char MMDVM_M17_EOT        = 0x49U;
+
+const unsigned char MMDVM_ACK         = 0x70U;
+
+const unsigned char CAP1_M17 = 0x20U;
+
+const unsigned char PROTOCOL_VERSION = 2U;
+
+const char* DESCRIPTION = "MMDVM Emulator for M17Client";
+
+const unsigned int BUFFER_LENGTH = 1000U;
+
+const unsigned int DEFAULT_SPACE = 10U;
+
+const uint64_t FRAME_TIME_NS = 40000000ULL;
+
+// The sync word is left alone, the modem has already found it
+const unsigned int SYNC_OFFSET = 1U + M17_SYNC_LENGTH_BYTES;
+
+const int POLL_TIMEOUT_MS = 5;
+
+static bool m_killed = false;
+
+static void sigHandler(int)
+{
+	m_killed = true;
+}
+
+static uint64_t getNS()
+{
+	struct timespec now;
+	::clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+int main(int argc, char** argv)
+{
+	std::string link;
+	float ber   = 0.0F;
+	float loss  = 0.0F;
+	unsigned int rssi  = 0U;
+	unsigned int space = DEFAULT_SPACE;
+	std::string address = "127.0.0.1";
+	unsigned int port = 0U;
+	unsigned int on   = 10U;
+	unsigned int off  = 5U;
+	unsigned int tcp  = 0U;
+	unsigned int udp  = 0U;
+
+	for (int currentArg = 1; currentArg < argc; ++currentArg) {
+		std::string arg = argv[currentArg];
+		if (arg == "--link" && (currentArg + 1) < argc) {
+			link = argv[++currentArg];
+		} else if (arg == "--tcp" && (currentArg + 1) < argc) {
+			tcp = (unsigned int)::atoi(argv[++currentArg]);
+		} else if (arg == "--udp" && (currentArg + 1) < argc) {
+			udp = (unsigned int)::atoi(argv[++currentArg]);
+		} else if (arg == "--ber" && (currentArg + 1) < argc) {
+			ber = float(::atof(argv[++currentArg]));
+		} else if (arg == "--loss" && (currentArg + 1) < argc) {
+			loss = float(::atof(argv[++currentArg]));
+		} else if (arg == "--rssi" && (currentArg + 1) < argc) {
+			rssi = (unsigned int)::atoi(argv[++currentArg]);
+		} else if (arg == "--space" && (currentArg + 1) < argc) {
+			space = (unsigned int)::atoi(argv[++currentArg]);
+		} else if (arg == "--ptt" && (currentArg + 1) < argc) {
+			port = (unsigned int)::atoi(argv[++currentArg]);
+		} else if (arg == "--address" && (currentArg + 1) < argc) {
+			address = argv[++currentArg];
+		} else if (arg == "--on" && (currentArg + 1) < argc) {
+			on = (unsigned int)::atoi(argv[++currentArg]);
+		} else if (arg == "--off" && (currentArg + 1) < argc) {
+			off = (unsigned int)::atoi(argv[++currentArg]);
+		} else {
+			::fprintf(stderr, "Usage: MMDVMEmulator [--link <path> | --tcp <port> | --udp <port>] [--ber <percent>] [--loss <percent>] [--rssi <raw>] [--space <frames>]\n");
+			::fprintf(stderr, "                     [--ptt <control port> [--address <address>] [--on <secs>] [--off <secs>]]\n");
+			return 1;
+		}
+	}
+
+	if (space == 0U || space > 255U || ber < 0.0F || ber > 100.0F || loss < 0.0F || loss > 100.0F || rssi > 0xFFFFU || on == 0U || off == 0U ||
+		tcp > 0xFFFFU || udp > 0xFFFFU || (tcp > 0U && udp > 0U)) {
+		::fprintf(stderr, "MMDVMEmulator: invalid parameter\n");
+		return 1;
+	}
+
+	::signal(SIGINT,  sigHandler);
+	::signal(SIGTERM, sigHandler);
+	::signal(SIGPIPE, SIG_IGN);
+
+	::LogInitialise(false, std::string(), std::string(), 0U, 1U, false);
+
+	CMMDVMEmulator emulator(link, ber / 100.0F, loss / 100.0F, rssi, space);
+
+	if (tcp > 0U)
+		emulator.setNetwork(true, tcp);
+	else if (udp > 0U)
+		emulator.setNetwork(false, udp);
+
+	if (port > 0U)
+		emulator.setPTT(address, port, on, off);
+
+	int ret = emulator.run();
+
+	::LogFinalise();
+
+	return ret;
+}
+
+CMMDVMEmulator::CMMDVMEmulator(const std::string& link, float ber, float loss, unsigned int rssi, unsigned int space) :
+m_link(link),
+m_ber(ber),
+m_loss(loss),
+m_rssi(rssi),
+m_space(space),
+m_master(-1),
+m_slave(-1),
+m_tcp(false),
+m_netPort(0U),
+m_listen(-1),
+m_hostAddr(),
+m_hostAddrLen(0U),
+m_buffer(NULL),
+m_mode(MODE_IDLE),
+m_length(0U),
+m_txQueue(),
+m_tx(false),
+m_overflow(false),
+m_txTime(0U),
+m_random(std::random_device()()),
+m_uniform(0.0F, 1.0F),
+m_socket(NULL),
+m_pttAddr(),
+m_pttAddrLen(0U),
+m_pttOn(0U),
+m_pttOff(0U),
+m_ptt(false),
+m_pttTime(0U),
+m_waiting(false),
+m_pttStart(0U),
+m_lastFrame(0U),
+m_received(0U),
+m_looped(0U),
+m_dropped(0U),
+m_overflows(0U),
+m_errors(0U),
+m_bits(0U),
+m_latencyCount(0U),
+m_latencyMin(0U),
+m_latencyMax(0U),
+m_latencyTotal(0U),
+m_gapMax(0U)
+{
+	assert(space > 0U);
+
+	m_buffer = new unsigned char[BUFFER_LENGTH];
+}
+
+CMMDVMEmulator::~CMMDVMEmulator()
+{
+	delete[] m_buffer;
+	delete   m_socket;
+}
+
+void CMMDVMEmulator::setPTT(const std::string& address, unsigned short port, unsigned int on, unsigned int off)
+{
+	assert(port > 0U);
+	assert(on > 0U);
+	assert(off > 0U);
+
+	if (CUDPSocket::lookup(address, port, m_pttAddr, m_pttAddrLen) != 0) {
+		LogError("Could not lookup the control address %s", address.c_str());
+		return;
+	}
+
+	m_socket = new CUDPSocket(0U);
+	m_pttOn  = on;
+	m_pttOff = off;
+}
+
+int CMMDVMEmulator::run()
+{
+	if (!open())
+		return 1;
+
+	uint64_t now = getNS();
+
+	// Give M17Client time to open the port before the first transmission
+	m_pttTime = now + m_pttOff * 1000000000ULL;
+
+	while (!m_killed) {
+		// Wait for a TCP host to connect before anything else
+		struct pollfd pfd;
+		pfd.fd      = m_master != -1 ? m_master : m_listen;
+		pfd.events  = POLLIN;
+		pfd.revents = 0;
+
+		int n = ::poll(&pfd, 1, POLL_TIMEOUT_MS);
+		if (n < 0 && errno != EINTR) {
+			LogError("Error returned from poll, err=%d", errno);
+			break;
+		}
+
+		now = getNS();
+
+		if (n > 0) {
+			if (m_master == -1)
+				acceptHost();
+			else
+				readHost(now);
+		}
+
+		playout(now);
+
+		if (m_socket != NULL)
+			clockPTT(now);
+	}
+
+	if (m_ptt)
+		sendCommand("TX:0");
+
+	report();
+
+	close();
+
+	return 0;
+}
+
+void CMMDVMEmulator::setNetwork(bool tcp, unsigned short port)
+{
+	assert(port > 0U);
+
+	m_tcp     = tcp;
+	m_netPort = port;
+}
+
+bool CMMDVMEmulator::open()
+{
+	if (m_netPort > 0U)
+		return openNetwork();
+
+	m_master = ::posix_openpt(O_RDWR | O_NOCTTY);
+	if (m_master < 0) {
+		LogError("Cannot open a pseudo-terminal, err=%d", errno);
+		return false;
+	}
+
+	if (::grantpt(m_master) < 0 || ::unlockpt(m_master) < 0) {
+		LogError("Cannot unlock the pseudo-terminal, err=%d", errno);
+		close();
+		return false;
+	}
+
+	const char* name = ::ptsname(m_master);
+	if (name == NULL) {
+		LogError("Cannot get the name of the pseudo-terminal, err=%d", errno);
+		close();
+		return false;
+	}
+
+	// Holding the slave side open stops reads failing when M17Client closes it,
+	// and it must be raw so that nothing is echoed before M17Client opens it
+	m_slave = ::open(name, O_RDWR | O_NOCTTY);
+	if (m_slave < 0) {
+		LogError("Cannot open %s, err=%d", name, errno);
+		close();
+		return false;
+	}
+
+	struct termios termios;
+	::tcgetattr(m_slave, &termios);
+	::cfmakeraw(&termios);
+	::tcsetattr(m_slave, TCSANOW, &termios);
+
+	int flags = ::fcntl(m_master, F_GETFL, 0);
+	::fcntl(m_master, F_SETFL, flags | O_NONBLOCK);
+
+	if (!m_link.empty()) {
+		::unlink(m_link.c_str());
+		if (::symlink(name, m_link.c_str()) < 0) {
+			LogError("Cannot link %s to %s, err=%d", m_link.c_str(), name, errno);
+			close();
+			return false;
+		}
+
+		LogMessage("MMDVM emulator is on %s, linked from %s", name, m_link.c_str());
+	} else {
+		LogMessage("MMDVM emulator is on %s", name);
+	}
+
+	return openControl();
+}
+
+bool CMMDVMEmulator::openNetwork()
+{
+	int fd = ::socket(AF_INET, m_tcp ? SOCK_STREAM : SOCK_DGRAM, 0);
+	if (fd < 0) {
+		LogError("Cannot create the socket, err=%d", errno);
+		return false;
+	}
+
+	int reuse = 1;
+	::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+	sockaddr_in addr;
+	::memset(&addr, 0x00U, sizeof(sockaddr_in));
+	addr.sin_family      = AF_INET;
+	addr.sin_port        = htons(m_netPort);
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+
+	if (::bind(fd, (sockaddr*)&addr, sizeof(sockaddr_in)) < 0) {
+		LogError("Cannot bind to port %u, err=%d", m_netPort, errno);
+		::close(fd);
+		return false;
+	}
+
+	int flags = ::fcntl(fd, F_GETFL, 0);
+	::fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+
+	// A UDP host is whoever sent the last datagram, a TCP host has to connect
+	if (m_tcp) {
+		if (::listen(fd, 1) < 0) {
+			LogError("Cannot listen on port %u, err=%d", m_netPort, errno);
+			::close(fd);
+			return false;
+		}
+
+		m_listen = fd;
+	} else {
+		m_master = fd;
+	}
+
+	LogMessage("MMDVM emulator is on %s port %u", m_tcp ? "TCP" : "UDP", m_netPort);
+
+	return openControl();
+}
+
+bool CMMDVMEmulator::openControl()
+{
+	LogMessage("BER: %.2f%%, frame loss: %.2f%%, RSSI: %u, M17 space: %u frames", m_ber * 100.0F, m_loss * 100.0F, m_rssi, m_space);
+
+	if (m_socket != NULL) {
+		if (!m_socket->open()) {
+			LogError("Cannot open the control socket");
+			close();
+			return false;
+		}
+
+		LogMessage("Keying the transmitter for %u seconds every %u seconds", m_pttOn, m_pttOn + m_pttOff);
+	}
+
+	return true;
+}
+
+void CMMDVMEmulator::acceptHost()
+{
+	int fd = ::accept(m_listen, NULL, NULL);
+	if (fd < 0) {
+		if (errno != EAGAIN && errno != EWOULDBLOCK)
+			LogError("Error returned from accept(), err=%d", errno);
+		return;
+	}
+
+	int flags = ::fcntl(fd, F_GETFL, 0);
+	::fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+
+	int noDelay = 1;
+	::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+	m_master = fd;
+	m_length = 0U;
+
+	LogMessage("M17Client has connected");
+}
+
+void CMMDVMEmulator::closeHost()
+{
+	LogMessage("M17Client has disconnected");
+
+	::close(m_master);
+	m_master = -1;
+	m_length = 0U;
+}
+
+void CMMDVMEmulator::close()
+{
+	if (m_socket != NULL)
+		m_socket->close();
+
+	if (!m_link.empty() && m_netPort == 0U)
+		::unlink(m_link.c_str());
+
+	if (m_listen != -1) {
+		::close(m_listen);
+		m_listen = -1;
+	}
+
+	if (m_slave != -1) {
+		::close(m_slave);
+		m_slave = -1;
+	}
+
+	if (m_master != -1) {
+		::close(m_master);
+		m_master = -1;
+	}
+}
+
+void CMMDVMEmulator::readHost(uint64_t now)
+{
+	ssize_t len;
+	if (m_netPort > 0U && !m_tcp) {
+		m_hostAddrLen = sizeof(sockaddr_storage);
+		len = ::recvfrom(m_master, m_buffer + m_length, BUFFER_LENGTH - m_length, 0, (sockaddr*)&m_hostAddr, &m_hostAddrLen);
+	} else {
+		len = ::read(m_master, m_buffer + m_length, BUFFER_LENGTH - m_length);
+	}
+
+	if (m_tcp && (len == 0 || (len < 0 && errno == ECONNRESET))) {
+		closeHost();
+		return;
+	}
+
+	if (len <= 0) {
+		if (len < 0 && errno != EAGAIN)
+			LogError("Error returned from read(), err=%d", errno);
+		return;
+	}
+
+	m_length += len;
+
+	// Parse every complete frame, anything not starting with a frame start is skipped
+	unsigned int offset = 0U;
+	while (offset < m_length) {
+		if (m_buffer[offset] != MMDVM_FRAME_START) {
+			offset++;
+			continue;
+		}
+
+		if ((m_length - offset) < 3U)
+			break;
+
+		unsigned int length = m_buffer[offset + 1U];
+		if (length == 0U)
+			length = m_buffer[offset + 2U] + 255U;
+
+		if (length < 3U) {
+			offset++;
+			continue;
+		}
+
+		if ((m_length - offset) < length)
+			break;
+
+		processFrame(m_buffer + offset, length, now);
+
+		offset += length;
+	}
+
+	m_length -= offset;
+	if (m_length > 0U)
+		::memmove(m_buffer, m_buffer + offset, m_length);
+}
+
+void CMMDVMEmulator::processFrame(const unsigned char* data, unsigned int length, uint64_t now)
+{
+	assert(data != NULL);
+
+	unsigned char type = data[1U] == 0U ? data[3U] : data[2U];
+
+	switch (type) {
+		case MMDVM_GET_VERSION:
+			writeVersion();
+			break;
+
+		case MMDVM_GET_STATUS:
+			writeStatus();
+			break;
+
+		case MMDVM_M17_LINK_SETUP:
+		case MMDVM_M17_STREAM:
+		case MMDVM_M17_EOT:
+			m_received++;
+
+			if (type == MMDVM_M17_LINK_SETUP && m_waiting) {
+				uint64_t latency = now - m_pttStart;
+
+				if (m_latencyCount == 0U || latency < m_latencyMin)
+					m_latencyMin = latency;
+				if (latency > m_latencyMax)
+					m_latencyMax = latency;
+				m_latencyTotal += latency;
+				m_latencyCount++;
+
+				LogMessage("PTT to first frame: %.1f ms", double(latency) / 1000000.0);
+				m_waiting = false;
+			}
+
+			if (m_lastFrame != 0U && (now - m_lastFrame) > m_gapMax)
+				m_gapMax = now - m_lastFrame;
+			m_lastFrame = type == MMDVM_M17_EOT ? 0U : now;
+
+			if (m_txQueue.size() >= m_space) {
+				LogWarning("M17 TX buffer overflow, %u frames queued", (unsigned int)m_txQueue.size());
+				m_overflow = true;
+				m_overflows++;
+			} else {
+				m_txQueue.push_back(std::vector<unsigned char>(data, data + length));
+			}
+			break;
+
+		case MMDVM_SET_MODE:
+			m_mode = data[3U];
+			writeACK(type);
+			break;
+
+		default:
+			// SET_CONFIG, SET_FREQ and the rest only need acknowledging
+			if (type < MMDVM_M17_LINK_SETUP)
+				writeACK(type);
+			break;
+	}
+}
+
+void CMMDVMEmulator::playout(uint64_t now)
+{
+	if (m_txQueue.empty()) {
+		m_tx = false;
+		return;
+	}
+
+	if (!m_tx) {
+		m_tx     = true;
+		m_txTime = now;
+	}
+
+	// One frame every 40ms, as it would go over the air
+	while (!m_txQueue.empty() && now >= m_txTime) {
+		loopback(m_txQueue.front());
+		m_txQueue.pop_front();
+
+		m_txTime += FRAME_TIME_NS;
+	}
+}
+
+void CMMDVMEmulator::loopback(const std::vector<unsigned char>& frame)
+{
+	unsigned char type = frame.at(2U);
+
+	if (type == MMDVM_M17_EOT) {
+		unsigned char buffer[3U];
+		buffer[0U] = MMDVM_FRAME_START;
+		buffer[1U] = 3U;
+		buffer[2U] = MMDVM_M17_EOT;
+		writeHost(buffer, 3U);
+		return;
+	}
+
+	if (m_loss > 0.0F && m_uniform(m_random) < m_loss) {
+		m_dropped++;
+		return;
+	}
+
+	unsigned char buffer[100U];
+	unsigned int length = (unsigned int)frame.size();
+	if (length > 98U)
+		length = 98U;
+
+	::memcpy(buffer, frame.data(), length);
+
+	if (m_ber > 0.0F) {
+		for (unsigned int i = 3U + SYNC_OFFSET; i < length; i++) {
+			for (unsigned int j = 0U; j < 8U; j++) {
+				if (m_uniform(m_random) < m_ber) {
+					buffer[i] ^= 0x80U >> j;
+					m_errors++;
+				}
+			}
+		}
+	}
+
+	if (length > (3U + SYNC_OFFSET))
+		m_bits += (length - 3U - SYNC_OFFSET) * 8U;
+
+	if (m_rssi > 0U) {
+		buffer[length++] = (m_rssi >> 8) & 0xFFU;
+		buffer[length++] = (m_rssi >> 0) & 0xFFU;
+	}
+
+	buffer[1U] = length;
+
+	writeHost(buffer, length);
+
+	m_looped++;
+}
+
+void CMMDVMEmulator::clockPTT(uint64_t now)
+{
+	if (now < m_pttTime)
+		return;
+
+	if (!m_ptt) {
+		sendCommand("TX:1");
+		m_ptt      = true;
+		m_waiting  = true;
+		m_pttStart = now;
+		m_pttTime  = now + m_pttOn * 1000000000ULL;
+	} else {
+		sendCommand("TX:0");
+		m_ptt     = false;
+		m_waiting = false;
+		m_pttTime = now + m_pttOff * 1000000000ULL;
+	}
+}
+
+void CMMDVMEmulator::sendCommand(const char* command)
+{
+	assert(command != NULL);
+	assert(m_socket != NULL);
+
+	m_socket->write(command, (unsigned int)::strlen(command), m_pttAddr, m_pttAddrLen);
+}
+
+void CMMDVMEmulator::writeVersion()
+{
+	unsigned char buffer[100U];
+
+	unsigned int length = (unsigned int)::strlen(DESCRIPTION);
+
+	buffer[0U] = MMDVM_FRAME_START;
+	buffer[1U] = 23U + length;
+	buffer[2U] = MMDVM_GET_VERSION;
+	buffer[3U] = PROTOCOL_VERSION;
+	buffer[4U] = CAP1_M17;
+	buffer[5U] = 0x00U;
+	buffer[6U] = 0xFFU;				// An unknown CPU
+
+	::memset(buffer + 7U, 0x00U, 16U);		// The UDID
+
+	::memcpy(buffer + 23U, DESCRIPTION, length);
+
+	writeHost(buffer, 23U + length);
+}
+
+void CMMDVMEmulator::writeStatus()
+{
+	unsigned char buffer[16U];
+	::memset(buffer, 0x00U, 16U);
+
+	unsigned int space = m_space - (unsigned int)m_txQueue.size();
+
+	buffer[0U] = MMDVM_FRAME_START;
+	buffer[1U] = 16U;
+	buffer[2U] = MMDVM_GET_STATUS;
+	buffer[3U] = m_mode;
+
+	if (m_tx)
+		buffer[4U] |= 0x01U;
+	if (m_overflow)
+		buffer[4U] |= 0x08U;
+
+	buffer[12U] = space;
+
+	m_overflow = false;
+
+	writeHost(buffer, 16U);
+}
+
+void CMMDVMEmulator::writeACK(unsigned char type)
+{
+	unsigned char buffer[4U];
+
+	buffer[0U] = MMDVM_FRAME_START;
+	buffer[1U] = 4U;
+	buffer[2U] = MMDVM_ACK;
+	buffer[3U] = type;
+
+	writeHost(buffer, 4U);
+}
+
+void CMMDVMEmulator::writeHost(const unsigned char* data, unsigned int length)
+{
+	assert(data != NULL);
+
+	if (m_master == -1)
+		return;
+
+	if (m_netPort > 0U && !m_tcp) {
+		if (m_hostAddrLen > 0U && ::sendto(m_master, data, length, 0, (sockaddr*)&m_hostAddr, m_hostAddrLen) < 0)
+			LogError("Error returned from sendto(), err=%d", errno);
+		return;
+	}
+
+	unsigned int ptr = 0U;
+	while (ptr < length) {
+		ssize_t n = ::write(m_master, data + ptr, length - ptr);
+		if (n < 0) {
+			if (errno != EAGAIN) {
+				LogError("Error returned from write(), err=%d", errno);
+				return;
+			}
+
+			::usleep(1000);
+			continue;
+		}
+
+		ptr += n;
+	}
+}
+
+void CMMDVMEmulator::report() const
+{
+	LogMessage("Frames received: %u, looped back: %u, dropped: %u, TX buffer overflows: %u", m_received, m_looped, m_dropped, m_overflows);
+
+	if (m_bits > 0U)
+		LogMessage("Bit errors added: %u/%u, %.3f%%", m_errors, m_bits, float(m_errors * 100U) / float(m_bits));
+
+	if (m_latencyCount > 0U)
+		LogMessage("PTT to first frame: %.1f/%.1f/%.1f ms min/max/ave over %u transmissions", double(m_latencyMin) / 1000000.0, double(m_latencyMax) / 1000000.0,
+			double(m_latencyTotal) / double(m_latencyCount) / 1000000.0, m_latencyCount);
+
+	if (m_gapMax > 0U)
+		LogMessage("Longest gap between frames from M17Client: %.1f ms", double(m_gapMax) / 1000000.0);
+}
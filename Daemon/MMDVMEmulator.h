@@ -0,0 +1,122 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(MMDVMEmulator_H)
+#define	MMDVMEmulator_H
+
+#include "UDPSocket.h"
+
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+
+/*
+ * Pretends to be an M17 capable MMDVM on the end of a pseudo-terminal, so
+ * that M17Client can be soak tested and profiled without any radio hardware.
+ * It answers GET_VERSION, GET_STATUS and the configuration commands, and the
+ * M17 frames that it is sent are played out at the real 40ms frame rate and
+ * then looped back as received frames, with optional bit errors, frame loss
+ * and RSSI bytes. The space in the M17 transmit buffer is reported in the
+ * status and overflows are flagged the same way as the real firmware.
+ * Instead of a pseudo-terminal it can listen on a TCP or UDP port, to stand
+ * in for a modem on a remote site.
+ *
+ * Optionally it keys the transmitter of M17Client through its control port
+ * at regular intervals and measures the time from the PTT command to the
+ * arrival of the first frame, and the gaps between the frames after that.
+ */
+class CMMDVMEmulator {
+public:
+	CMMDVMEmulator(const std::string& link, float ber, float loss, unsigned int rssi, unsigned int space);
+	~CMMDVMEmulator();
+
+	void setNetwork(bool tcp, unsigned short port);
+
+	void setPTT(const std::string& address, unsigned short port, unsigned int on, unsigned int off);
+
+	int run();
+
+private:
+	std::string    m_link;
+	float          m_ber;
+	float          m_loss;
+	unsigned int   m_rssi;
+	unsigned int   m_space;
+	int            m_master;
+	int            m_slave;
+	bool           m_tcp;
+	unsigned short m_netPort;
+	int            m_listen;
+	sockaddr_storage m_hostAddr;
+	socklen_t      m_hostAddrLen;
+	unsigned char* m_buffer;
+	unsigned char  m_mode;
+	unsigned int   m_length;
+	std::deque<std::vector<unsigned char>> m_txQueue;
+	bool           m_tx;
+	bool           m_overflow;
+	uint64_t       m_txTime;
+	std::mt19937   m_random;
+	std::uniform_real_distribution<float> m_uniform;
+	CUDPSocket*    m_socket;
+	sockaddr_storage m_pttAddr;
+	unsigned int   m_pttAddrLen;
+	unsigned int   m_pttOn;
+	unsigned int   m_pttOff;
+	bool           m_ptt;
+	uint64_t       m_pttTime;
+	bool           m_waiting;
+	uint64_t       m_pttStart;
+	uint64_t       m_lastFrame;
+	unsigned int   m_received;
+	unsigned int   m_looped;
+	unsigned int   m_dropped;
+	unsigned int   m_overflows;
+	unsigned int   m_errors;
+	unsigned int   m_bits;
+	unsigned int   m_latencyCount;
+	uint64_t       m_latencyMin;
+	uint64_t       m_latencyMax;
+	uint64_t       m_latencyTotal;
+	uint64_t       m_gapMax;
+
+	bool open();
+	bool openNetwork();
+	bool openControl();
+	void acceptHost();
+	void closeHost();
+	void close();
+
+	void readHost(uint64_t now);
+	void processFrame(const unsigned char* data, unsigned int length, uint64_t now);
+	void playout(uint64_t now);
+	void loopback(const std::vector<unsigned char>& frame);
+	void clockPTT(uint64_t now);
+	void sendCommand(const char* command);
+
+	void writeVersion();
+	void writeStatus();
+	void writeACK(unsigned char type);
+	void writeHost(const unsigned char* data, unsigned int length);
+
+	void report() const;
+};
+
+#endif
@@ -33,6 +33,8 @@
 #include <cstdio>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
+#include <cstdlib>
 #include <ctime>
 
 #if defined(_WIN32) || defined(_WIN64)
@@ -109,8 +111,31 @@ const unsigned char MMDVM_DEBUG_DUMP  = 0xFAU;
 
 const unsigned int MAX_RESPONSES = 30U;
 
+const unsigned int MAX_FRAMES_PER_CLOCK = 50U;
+
 const unsigned int BUFFER_LENGTH = 2000U;
 
+const unsigned int M17_BURST_LENGTH = 10U * (M17_FRAME_LENGTH_BYTES + 4U);
+
+const uint64_t M17_FRAME_TIME_NS = 40000000U;
+
+// The port latency figures are logged this often, and when the port closes
+const unsigned int STATS_INTERVAL_SECS = 600U;
+
+static uint64_t getNS()
+{
+	struct timespec now;
+	::clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+// A mode that is compiled out keeps a token buffer which is never used
+constexpr unsigned int bufferLength(unsigned int mode, unsigned int length)
+{
+	return hasModemMode(mode) ? length : 1U;
+}
+
 const unsigned char CAP1_DSTAR  = 0x01U;
 const unsigned char CAP1_DMR    = 0x02U;
 const unsigned char CAP1_YSF    = 0x04U;
@@ -166,30 +191,34 @@ m_ax25Enabled(false),
 m_rxDCOffset(0),
 m_txDCOffset(0),
 m_port(NULL),
+m_capture(NULL),
 m_buffer(NULL),
 m_length(0U),
 m_offset(0U),
 m_state(SS_START),
+m_readBuffer(NULL),
+m_readLength(0U),
+m_readPtr(0U),
 m_type(0U),
-m_rxDStarData(1000U, "Modem RX D-Star"),
-m_txDStarData(1000U, "Modem TX D-Star"),
-m_rxDMRData1(1000U, "Modem RX DMR1"),
-m_rxDMRData2(1000U, "Modem RX DMR2"),
-m_txDMRData1(1000U, "Modem TX DMR1"),
-m_txDMRData2(1000U, "Modem TX DMR2"),
-m_rxYSFData(1000U, "Modem RX YSF"),
-m_txYSFData(1000U, "Modem TX YSF"),
-m_rxP25Data(1000U, "Modem RX P25"),
-m_txP25Data(1000U, "Modem TX P25"),
-m_rxNXDNData(1000U, "Modem RX NXDN"),
-m_txNXDNData(1000U, "Modem TX NXDN"),
-m_rxM17Data(1000U, "Modem RX M17"),
-m_txM17Data(1000U, "Modem TX M17"),
-m_txPOCSAGData(1000U, "Modem TX POCSAG"),
-m_rxFMData(5000U, "Modem RX FM"),
-m_txFMData(5000U, "Modem TX FM"),
-m_rxAX25Data(1000U, "Modem RX AX.25"),
-m_txAX25Data(1000U, "Modem TX AX.25"),
+m_rxDStarData(bufferLength(MODEM_DSTAR, 1000U), "Modem RX D-Star"),
+m_txDStarData(bufferLength(MODEM_DSTAR, 1000U), "Modem TX D-Star"),
+m_rxDMRData1(bufferLength(MODEM_DMR, 1000U), "Modem RX DMR1"),
+m_rxDMRData2(bufferLength(MODEM_DMR, 1000U), "Modem RX DMR2"),
+m_txDMRData1(bufferLength(MODEM_DMR, 1000U), "Modem TX DMR1"),
+m_txDMRData2(bufferLength(MODEM_DMR, 1000U), "Modem TX DMR2"),
+m_rxYSFData(bufferLength(MODEM_YSF, 1000U), "Modem RX YSF"),
+m_txYSFData(bufferLength(MODEM_YSF, 1000U), "Modem TX YSF"),
+m_rxP25Data(bufferLength(MODEM_P25, 1000U), "Modem RX P25"),
+m_txP25Data(bufferLength(MODEM_P25, 1000U), "Modem TX P25"),
+m_rxNXDNData(bufferLength(MODEM_NXDN, 1000U), "Modem RX NXDN"),
+m_txNXDNData(bufferLength(MODEM_NXDN, 1000U), "Modem TX NXDN"),
+m_rxM17Data(bufferLength(MODEM_M17, 1000U), "Modem RX M17"),
+m_txM17Data(bufferLength(MODEM_M17, 1000U), "Modem TX M17"),
+m_txPOCSAGData(bufferLength(MODEM_POCSAG, 1000U), "Modem TX POCSAG"),
+m_rxFMData(bufferLength(MODEM_FM, 5000U), "Modem RX FM"),
+m_txFMData(bufferLength(MODEM_FM, 5000U), "Modem TX FM"),
+m_rxAX25Data(bufferLength(MODEM_AX25, 1000U), "Modem RX AX.25"),
+m_txAX25Data(bufferLength(MODEM_AX25, 1000U), "Modem TX AX.25"),
 m_rxSerialData(1000U, "Modem RX Serial"),
 m_txSerialData(1000U, "Modem TX Serial"),
 m_rxTransparentData(1000U, "Modem RX Transparent"),
@@ -198,6 +227,15 @@ m_sendTransparentDataFrameType(0U),
 m_statusTimer(1000U, 0U, 250U),
 m_inactivityTimer(1000U, 2U),
 m_playoutTimer(1000U, 0U, 10U),
+m_statsTimer(1000U, STATS_INTERVAL_SECS),
+m_statusSent(0U),
+m_statusReplies(0U),
+m_statusTime(0U),
+m_statusMax(0U),
+m_lastStream(0U),
+m_streamFrames(0U),
+m_streamError(0U),
+m_streamMax(0U),
 m_dstarSpace(0U),
 m_dmrSpace1(0U),
 m_dmrSpace2(0U),
@@ -212,6 +250,7 @@ m_tx(false),
 m_cd(false),
 m_lockout(false),
 m_error(false),
+m_reset(false),
 m_mode(MODE_IDLE),
 m_hwType(HWT_UNKNOWN),
 m_ax25RXTwist(0),
@@ -255,13 +294,15 @@ m_fmExtEnable(false),
 m_capabilities1(0x00U),
 m_capabilities2(0x00U)
 {
-	m_buffer = new unsigned char[BUFFER_LENGTH];
+	m_buffer     = new unsigned char[BUFFER_LENGTH];
+	m_readBuffer = new unsigned char[BUFFER_LENGTH];
 }
 
 CModem::~CModem()
 {
 	delete   m_port;
 	delete[] m_buffer;
+	delete[] m_readBuffer;
 }
 
 void CModem::setPort(IModemPort* port)
@@ -271,6 +312,13 @@ void CModem::setPort(IModemPort* port)
 	m_port = port;
 }
 
+void CModem::setCapture(CModemCapture* capture)
+{
+	assert(capture != NULL);
+
+	m_capture = capture;
+}
+
 void CModem::setRFParams(unsigned int rxFrequency, int rxOffset, bool rxInvert, unsigned int txFrequency, int txOffset, bool txInvert, int txDCOffset, int rxDCOffset, float rfLevel, unsigned int pocsagFrequency)
 {
 	m_rxFrequency     = rxFrequency + rxOffset;
@@ -311,15 +359,15 @@ bool CModem::changeFrequency(unsigned int rxFrequency, int rxOffset, bool rxInve
 
 void CModem::setModeParams(bool dstarEnabled, bool dmrEnabled, bool ysfEnabled, bool p25Enabled, bool nxdnEnabled, bool m17Enabled, bool pocsagEnabled, bool fmEnabled, bool ax25Enabled, unsigned char mode)
 {
-	m_dstarEnabled  = dstarEnabled;
-	m_dmrEnabled    = dmrEnabled;
-	m_ysfEnabled    = ysfEnabled;
-	m_p25Enabled    = p25Enabled;
-	m_nxdnEnabled   = nxdnEnabled;
-	m_m17Enabled    = m17Enabled;
-	m_pocsagEnabled = pocsagEnabled;
-	m_fmEnabled     = fmEnabled;
-	m_ax25Enabled   = ax25Enabled;
+	m_dstarEnabled  = hasModemMode(MODEM_DSTAR) && dstarEnabled;
+	m_dmrEnabled    = hasModemMode(MODEM_DMR) && dmrEnabled;
+	m_ysfEnabled    = hasModemMode(MODEM_YSF) && ysfEnabled;
+	m_p25Enabled    = hasModemMode(MODEM_P25) && p25Enabled;
+	m_nxdnEnabled   = hasModemMode(MODEM_NXDN) && nxdnEnabled;
+	m_m17Enabled    = hasModemMode(MODEM_M17) && m17Enabled;
+	m_pocsagEnabled = hasModemMode(MODEM_POCSAG) && pocsagEnabled;
+	m_fmEnabled     = hasModemMode(MODEM_FM) && fmEnabled;
+	m_ax25Enabled   = hasModemMode(MODEM_AX25) && ax25Enabled;
 	m_mode          = mode;
 }
 
@@ -387,6 +435,11 @@ bool CModem::open()
 	if (!ret)
 		return false;
 
+	// Anything left over from before belongs to the old connection
+	m_state      = SS_START;
+	m_readLength = 0U;
+	m_readPtr    = 0U;
+
 	ret = readVersion();
 	if (!ret) {
 		m_port->close();
@@ -452,6 +505,10 @@ bool CModem::open()
 	}
 
 	m_statusTimer.start();
+	m_statsTimer.start();
+
+	m_statusSent = 0U;
+	m_lastStream = 0U;
 
 	m_error  = false;
 	m_offset = 0U;
@@ -463,6 +520,9 @@ void CModem::clock(unsigned int ms)
 {
 	assert(m_port != NULL);
 
+	if (m_reset)
+		return;
+
 	// Poll the modem status every 250ms
 	m_statusTimer.clock(ms);
 	if (m_statusTimer.hasExpired()) {
@@ -470,27 +530,29 @@ void CModem::clock(unsigned int ms)
 		m_statusTimer.start();
 	}
 
+	m_statsTimer.clock(ms);
+	if (m_statsTimer.hasExpired()) {
+		printStats();
+		m_statsTimer.start();
+	}
+
 	m_inactivityTimer.clock(ms);
 	if (m_inactivityTimer.hasExpired()) {
 		LogError("No reply from the modem for some time, resetting it");
 		m_error = true;
+		m_reset = true;
 		close();
-
-		CThread::sleep(2000U);		// 2s
-		while (!open())
-			CThread::sleep(5000U);	// 5s
+		return;
 	}
 
-	RESP_TYPE_MMDVM type = getResponse();
+	// Handle every complete frame that has arrived since the last call
+	for (unsigned int i = 0U; i < MAX_FRAMES_PER_CLOCK; i++) {
+		RESP_TYPE_MMDVM type = getResponse();
+		if (type != RTM_OK)
+			break;
 
-	if (type == RTM_TIMEOUT) {
-		// Nothing to do
-	} else if (type == RTM_ERROR) {
-		// Nothing to do
-	} else {
-		// type == RTM_OK
 		switch (m_type) {
-			case MMDVM_DSTAR_HEADER: {
+			case MMDVM_DSTAR_HEADER: if constexpr (hasModemMode(MODEM_DSTAR)) {
 					if (m_trace)
 						CUtils::dump(1U, "RX D-Star Header", m_buffer, m_length);
 
@@ -504,7 +566,7 @@ void CModem::clock(unsigned int ms)
 				}
 				break;
 
-			case MMDVM_DSTAR_DATA: {
+			case MMDVM_DSTAR_DATA: if constexpr (hasModemMode(MODEM_DSTAR)) {
 					if (m_trace)
 						CUtils::dump(1U, "RX D-Star Data", m_buffer, m_length);
 
@@ -518,7 +580,7 @@ void CModem::clock(unsigned int ms)
 				}
 				break;
 
-			case MMDVM_DSTAR_LOST: {
+			case MMDVM_DSTAR_LOST: if constexpr (hasModemMode(MODEM_DSTAR)) {
 					if (m_trace)
 						CUtils::dump(1U, "RX D-Star Lost", m_buffer, m_length);
 
@@ -530,7 +592,7 @@ void CModem::clock(unsigned int ms)
 				}
 				break;
 
-			case MMDVM_DSTAR_EOT: {
+			case MMDVM_DSTAR_EOT: if constexpr (hasModemMode(MODEM_DSTAR)) {
 					if (m_trace)
 						CUtils::dump(1U, "RX D-Star EOT", m_buffer, m_length);
 
@@ -542,7 +604,7 @@ void CModem::clock(unsigned int ms)
 				}
 				break;
 
-			case MMDVM_DMR_DATA1: {
+			case MMDVM_DMR_DATA1: if constexpr (hasModemMode(MODEM_DMR)) {
 					if (m_trace)
 						CUtils::dump(1U, "RX DMR Data 1", m_buffer, m_length);
 
@@ -559,7 +621,7 @@ void CModem::clock(unsigned int ms)
 				}
 				break;
 
-			case MMDVM_DMR_DATA2: {
+			case MMDVM_DMR_DATA2: if constexpr (hasModemMode(MODEM_DMR)) {
 					if (m_trace)
 						CUtils::dump(1U, "RX DMR Data 2", m_buffer, m_length);
 
@@ -576,7 +638,7 @@ void CModem::clock(unsigned int ms)
 				}
 				break;
 
-			case MMDVM_DMR_LOST1: {
+			case MMDVM_DMR_LOST1: if constexpr (hasModemMode(MODEM_DMR)) {
 					if (m_trace)
 						CUtils::dump(1U, "RX DMR Lost 1", m_buffer, m_length);
 
@@ -588,7 +650,7 @@ void CModem::clock(unsigned int ms)
 				}
 				break;
 
-			case MMDVM_DMR_LOST2: {
+			case MMDVM_DMR_LOST2: if constexpr (hasModemMode(MODEM_DMR)) {
 					if (m_trace)
 						CUtils::dump(1U, "RX DMR Lost 2", m_buffer, m_length);
 
@@ -600,7 +662,7 @@ void CModem::clock(unsigned int ms)
 				}
 				break;
 
-			case MMDVM_YSF_DATA: {
+			case MMDVM_YSF_DATA: if constexpr (hasModemMode(MODEM_YSF)) {
 					if (m_trace)
 						CUtils::dump(1U, "RX YSF Data", m_buffer, m_length);
 
@@ -614,7 +676,7 @@ void CModem::clock(unsigned int ms)
 				}
 				break;
 
-			case MMDVM_YSF_LOST: {
+			case MMDVM_YSF_LOST: if constexpr (hasModemMode(MODEM_YSF)) {
 					if (m_trace)
 						CUtils::dump(1U, "RX YSF Lost", m_buffer, m_length);
 
@@ -626,7 +688,7 @@ void CModem::clock(unsigned int ms)
 				}
 				break;
 
-			case MMDVM_P25_HDR: {
+			case MMDVM_P25_HDR: if constexpr (hasModemMode(MODEM_P25)) {
 				if (m_trace)
 					CUtils::dump(1U, "RX P25 Header", m_buffer, m_length);
 
@@ -640,7 +702,7 @@ void CModem::clock(unsigned int ms)
 			}
 			break;
 
-			case MMDVM_P25_LDU: {
+			case MMDVM_P25_LDU: if constexpr (hasModemMode(MODEM_P25)) {
 				if (m_trace)
 					CUtils::dump(1U, "RX P25 LDU", m_buffer, m_length);
 
@@ -654,7 +716,7 @@ void CModem::clock(unsigned int ms)
 			}
 			break;
 
-			case MMDVM_P25_LOST: {
+			case MMDVM_P25_LOST: if constexpr (hasModemMode(MODEM_P25)) {
 				if (m_trace)
 					CUtils::dump(1U, "RX P25 Lost", m_buffer, m_length);
 
@@ -666,7 +728,7 @@ void CModem::clock(unsigned int ms)
 			}
 			break;
 
-			case MMDVM_NXDN_DATA: {
+			case MMDVM_NXDN_DATA: if constexpr (hasModemMode(MODEM_NXDN)) {
 				if (m_trace)
 					CUtils::dump(1U, "RX NXDN Data", m_buffer, m_length);
 
@@ -680,7 +742,7 @@ void CModem::clock(unsigned int ms)
 			}
 			break;
 
-			case MMDVM_NXDN_LOST: {
+			case MMDVM_NXDN_LOST: if constexpr (hasModemMode(MODEM_NXDN)) {
 				if (m_trace)
 					CUtils::dump(1U, "RX NXDN Lost", m_buffer, m_length);
 
@@ -692,10 +754,12 @@ void CModem::clock(unsigned int ms)
 			}
 			break;
 
-			case MMDVM_M17_LINK_SETUP: {
+			case MMDVM_M17_LINK_SETUP: if constexpr (hasModemMode(MODEM_M17)) {
 				if (m_trace)
 					CUtils::dump(1U, "RX M17 Link Setup", m_buffer, m_length);
 
+				m_lastStream = getNS();
+
 				unsigned char data = m_length - 2U;
 				m_rxM17Data.addData(&data, 1U);
 
@@ -706,10 +770,12 @@ void CModem::clock(unsigned int ms)
 			}
 			break;
 
-			case MMDVM_M17_STREAM: {
+			case MMDVM_M17_STREAM: if constexpr (hasModemMode(MODEM_M17)) {
 				if (m_trace)
 					CUtils::dump(1U, "RX M17 Stream Data", m_buffer, m_length);
 
+				streamArrived();
+
 				unsigned char data = m_length - 2U;
 				m_rxM17Data.addData(&data, 1U);
 
@@ -720,10 +786,12 @@ void CModem::clock(unsigned int ms)
 			}
 			break;
 
-			case MMDVM_M17_EOT: {
+			case MMDVM_M17_EOT: if constexpr (hasModemMode(MODEM_M17)) {
 				if (m_trace)
 					CUtils::dump(1U, "RX M17 EOT", m_buffer, m_length);
 
+				m_lastStream = 0U;
+
 				unsigned char data = 1U;
 				m_rxM17Data.addData(&data, 1U);
 
@@ -732,10 +800,12 @@ void CModem::clock(unsigned int ms)
 			}
 			break;
 
-			case MMDVM_M17_LOST: {
+			case MMDVM_M17_LOST: if constexpr (hasModemMode(MODEM_M17)) {
 				if (m_trace)
 					CUtils::dump(1U, "RX M17 Lost", m_buffer, m_length);
 
+				m_lastStream = 0U;
+
 				unsigned char data = 1U;
 				m_rxM17Data.addData(&data, 1U);
 
@@ -744,7 +814,7 @@ void CModem::clock(unsigned int ms)
 			}
 			break;
 
-			case MMDVM_FM_DATA: {
+			case MMDVM_FM_DATA: if constexpr (hasModemMode(MODEM_FM)) {
 				if (m_trace)
 					CUtils::dump(1U, "RX FM Data", m_buffer, m_length);
 
@@ -758,7 +828,7 @@ void CModem::clock(unsigned int ms)
 			}
 			break;
 
-			case MMDVM_FM_CONTROL: {
+			case MMDVM_FM_CONTROL: if constexpr (hasModemMode(MODEM_FM)) {
 				if (m_trace)
 					CUtils::dump(1U, "RX FM Control", m_buffer, m_length);
 
@@ -772,7 +842,7 @@ void CModem::clock(unsigned int ms)
 			}
 			break;
 
-			case MMDVM_FM_EOT: {
+			case MMDVM_FM_EOT: if constexpr (hasModemMode(MODEM_FM)) {
 				if(m_trace)
 					CUtils::dump(1U, "RX FM End of transmission", m_buffer, m_length);
 
@@ -786,7 +856,7 @@ void CModem::clock(unsigned int ms)
 			}
 			break;
 
-			case MMDVM_AX25_DATA: {
+			case MMDVM_AX25_DATA: if constexpr (hasModemMode(MODEM_AX25)) {
 				if (m_trace)
 					CUtils::dump(1U, "RX AX.25 Data", m_buffer, m_length);
 
@@ -801,6 +871,8 @@ void CModem::clock(unsigned int ms)
 				// if (m_trace)
 				//	CUtils::dump(1U, "GET_STATUS", m_buffer, m_length);
 
+				statusArrived();
+
 				switch (m_protocolVersion) {
 				case 1U: {
 						m_mode = m_buffer[m_offset + 1U];
@@ -941,10 +1013,12 @@ void CModem::clock(unsigned int ms)
 
 	// Only feed data to the modem if the playout timer has expired
 	m_playoutTimer.clock(ms);
-	if (!m_playoutTimer.hasExpired())
+	if (!m_playoutTimer.hasExpired()) {
+		m_port->flush();
 		return;
+	}
 
-	if (m_dstarSpace > 1U && !m_txDStarData.isEmpty()) {
+	if (hasModemMode(MODEM_DSTAR) && m_dstarSpace > 1U && !m_txDStarData.isEmpty()) {
 		unsigned char buffer[4U];
 		m_txDStarData.peek(buffer, 4U);
 
@@ -973,7 +1047,7 @@ void CModem::clock(unsigned int ms)
 				break;
 			}
 
-			int ret = m_port->write(m_buffer, len);
+			int ret = writePort(m_buffer, len);
 			if (ret != int(len))
 				LogWarning("Error when writing D-Star data to the MMDVM");
 
@@ -981,7 +1055,7 @@ void CModem::clock(unsigned int ms)
 		}
 	}
 
-	if (m_dmrSpace1 > 1U && !m_txDMRData1.isEmpty()) {
+	if (hasModemMode(MODEM_DMR) && m_dmrSpace1 > 1U && !m_txDMRData1.isEmpty()) {
 		unsigned char len = 0U;
 		m_txDMRData1.getData(&len, 1U);
 		m_txDMRData1.getData(m_buffer, len);
@@ -989,7 +1063,7 @@ void CModem::clock(unsigned int ms)
 		if (m_trace)
 			CUtils::dump(1U, "TX DMR Data 1", m_buffer, len);
 
-		int ret = m_port->write(m_buffer, len);
+		int ret = writePort(m_buffer, len);
 		if (ret != int(len))
 			LogWarning("Error when writing DMR data to the MMDVM");
 
@@ -998,7 +1072,7 @@ void CModem::clock(unsigned int ms)
 		m_dmrSpace1--;
 	}
 
-	if (m_dmrSpace2 > 1U && !m_txDMRData2.isEmpty()) {
+	if (hasModemMode(MODEM_DMR) && m_dmrSpace2 > 1U && !m_txDMRData2.isEmpty()) {
 		unsigned char len = 0U;
 		m_txDMRData2.getData(&len, 1U);
 		m_txDMRData2.getData(m_buffer, len);
@@ -1006,7 +1080,7 @@ void CModem::clock(unsigned int ms)
 		if (m_trace)
 			CUtils::dump(1U, "TX DMR Data 2", m_buffer, len);
 
-		int ret = m_port->write(m_buffer, len);
+		int ret = writePort(m_buffer, len);
 		if (ret != int(len))
 			LogWarning("Error when writing DMR data to the MMDVM");
 
@@ -1015,7 +1089,7 @@ void CModem::clock(unsigned int ms)
 		m_dmrSpace2--;
 	}
 
-	if (m_ysfSpace > 1U && !m_txYSFData.isEmpty()) {
+	if (hasModemMode(MODEM_YSF) && m_ysfSpace > 1U && !m_txYSFData.isEmpty()) {
 		unsigned char len = 0U;
 		m_txYSFData.getData(&len, 1U);
 		m_txYSFData.getData(m_buffer, len);
@@ -1023,7 +1097,7 @@ void CModem::clock(unsigned int ms)
 		if (m_trace)
 			CUtils::dump(1U, "TX YSF Data", m_buffer, len);
 
-		int ret = m_port->write(m_buffer, len);
+		int ret = writePort(m_buffer, len);
 		if (ret != int(len))
 			LogWarning("Error when writing YSF data to the MMDVM");
 
@@ -1032,7 +1106,7 @@ void CModem::clock(unsigned int ms)
 		m_ysfSpace--;
 	}
 
-	if (m_p25Space > 1U && !m_txP25Data.isEmpty()) {
+	if (hasModemMode(MODEM_P25) && m_p25Space > 1U && !m_txP25Data.isEmpty()) {
 		unsigned char len = 0U;
 		m_txP25Data.getData(&len, 1U);
 		m_txP25Data.getData(m_buffer, len);
@@ -1044,7 +1118,7 @@ void CModem::clock(unsigned int ms)
 				CUtils::dump(1U, "TX P25 LDU", m_buffer, len);
 		}
 
-		int ret = m_port->write(m_buffer, len);
+		int ret = writePort(m_buffer, len);
 		if (ret != int(len))
 			LogWarning("Error when writing P25 data to the MMDVM");
 
@@ -1053,7 +1127,7 @@ void CModem::clock(unsigned int ms)
 		m_p25Space--;
 	}
 
-	if (m_nxdnSpace > 1U && !m_txNXDNData.isEmpty()) {
+	if (hasModemMode(MODEM_NXDN) && m_nxdnSpace > 1U && !m_txNXDNData.isEmpty()) {
 		unsigned char len = 0U;
 		m_txNXDNData.getData(&len, 1U);
 		m_txNXDNData.getData(m_buffer, len);
@@ -1061,7 +1135,7 @@ void CModem::clock(unsigned int ms)
 		if (m_trace)
 			CUtils::dump(1U, "TX NXDN Data", m_buffer, len);
 
-		int ret = m_port->write(m_buffer, len);
+		int ret = writePort(m_buffer, len);
 		if (ret != int(len))
 			LogWarning("Error when writing NXDN data to the MMDVM");
 
@@ -1070,35 +1144,47 @@ void CModem::clock(unsigned int ms)
 		m_nxdnSpace--;
 	}
 
-	if (m_m17Space > 1U && !m_txM17Data.isEmpty()) {
-		unsigned char len = 0U;
-		m_txM17Data.getData(&len, 1U);
-		m_txM17Data.getData(m_buffer, len);
+	if (hasModemMode(MODEM_M17) && m_m17Space > 1U && !m_txM17Data.isEmpty()) {
+		// Send as many frames as the modem has room for in a single write
+		unsigned char buffer[M17_BURST_LENGTH];
+		unsigned int length = 0U;
 
-		if (m_trace) {
-			switch (m_buffer[2U]) {
-			case MMDVM_M17_LINK_SETUP:
-				CUtils::dump(1U, "TX M17 Link Setup", m_buffer, len);
-				break;
-			case MMDVM_M17_STREAM:
-				CUtils::dump(1U, "TX M17 Stream Data", m_buffer, len);
-				break;
-			case MMDVM_M17_EOT:
-				CUtils::dump(1U, "TX M17 EOT", m_buffer, len);
+		while (m_m17Space > 1U && !m_txM17Data.isEmpty()) {
+			unsigned char len = 0U;
+			m_txM17Data.peek(&len, 1U);
+			if ((length + len) > M17_BURST_LENGTH)
 				break;
+
+			m_txM17Data.getData(&len, 1U);
+			m_txM17Data.getData(buffer + length, len);
+
+			if (m_trace) {
+				switch (buffer[length + 2U]) {
+				case MMDVM_M17_LINK_SETUP:
+					CUtils::dump(1U, "TX M17 Link Setup", buffer + length, len);
+					break;
+				case MMDVM_M17_STREAM:
+					CUtils::dump(1U, "TX M17 Stream Data", buffer + length, len);
+					break;
+				case MMDVM_M17_EOT:
+					CUtils::dump(1U, "TX M17 EOT", buffer + length, len);
+					break;
+				}
 			}
+
+			length += len;
+
+			m_m17Space--;
 		}
 
-		int ret = m_port->write(m_buffer, len);
-		if (ret != int(len))
+		int ret = writePort(buffer, length);
+		if (ret != int(length))
 			LogWarning("Error when writing M17 data to the MMDVM");
 
 		m_playoutTimer.start();
-
-		m_m17Space--;
 	}
 
-	if (m_pocsagSpace > 1U && !m_txPOCSAGData.isEmpty()) {
+	if (hasModemMode(MODEM_POCSAG) && m_pocsagSpace > 1U && !m_txPOCSAGData.isEmpty()) {
 		unsigned char len = 0U;
 		m_txPOCSAGData.getData(&len, 1U);
 		m_txPOCSAGData.getData(m_buffer, len);
@@ -1106,7 +1192,7 @@ void CModem::clock(unsigned int ms)
 		if (m_trace)
 			CUtils::dump(1U, "TX POCSAG Data", m_buffer, len);
 
-		int ret = m_port->write(m_buffer, len);
+		int ret = writePort(m_buffer, len);
 		if (ret != int(len))
 			LogWarning("Error when writing POCSAG data to the MMDVM");
 
@@ -1115,7 +1201,7 @@ void CModem::clock(unsigned int ms)
 		m_pocsagSpace--;
 	}
 
-	if (m_fmSpace > 1U && !m_txFMData.isEmpty()) {
+	if (hasModemMode(MODEM_FM) && m_fmSpace > 1U && !m_txFMData.isEmpty()) {
 		unsigned int len = 0U;
 		m_txFMData.getData((unsigned char*)&len, sizeof(unsigned int));
 		m_txFMData.getData(m_buffer, len);
@@ -1127,7 +1213,7 @@ void CModem::clock(unsigned int ms)
 				CUtils::dump(1U, "TX FM Data", m_buffer, len);
 		}
 
-		int ret = m_port->write(m_buffer, len);
+		int ret = writePort(m_buffer, len);
 		if (ret != int(len))
 			LogWarning("Error when writing FM data to the MMDVM");
 
@@ -1136,7 +1222,7 @@ void CModem::clock(unsigned int ms)
 		m_fmSpace--;
 	}
 
-	if (m_ax25Space > 0U && !m_txAX25Data.isEmpty()) {
+	if (hasModemMode(MODEM_AX25) && m_ax25Space > 0U && !m_txAX25Data.isEmpty()) {
 		unsigned int len = 0U;
 		m_txAX25Data.getData((unsigned char*)&len, sizeof(unsigned int));
 		m_txAX25Data.getData(m_buffer, len);
@@ -1144,7 +1230,7 @@ void CModem::clock(unsigned int ms)
 		if (m_trace)
 			CUtils::dump(1U, "TX AX.25 Data", m_buffer, len);
 
-		int ret = m_port->write(m_buffer, len);
+		int ret = writePort(m_buffer, len);
 		if (ret != int(len))
 			LogWarning("Error when writing AX.25 data to the MMDVM");
 
@@ -1161,7 +1247,7 @@ void CModem::clock(unsigned int ms)
 		if (m_trace)
 			CUtils::dump(1U, "TX Transparent Data", m_buffer, len);
 
-		int ret = m_port->write(m_buffer, len);
+		int ret = writePort(m_buffer, len);
 		if (ret != int(len))
 			LogWarning("Error when writing Transparent data to the MMDVM");
 	}
@@ -1174,10 +1260,28 @@ void CModem::clock(unsigned int ms)
 		if (m_trace)
 			CUtils::dump(1U, "TX Serial Data", m_buffer, len);
 
-		int ret = m_port->write(m_buffer, len);
+		int ret = writePort(m_buffer, len);
 		if (ret != int(len))
 			LogWarning("Error when writing Serial data to the MMDVM");
 	}
+
+	m_port->flush();
+}
+
+bool CModem::needsReset() const
+{
+	return m_reset;
+}
+
+void CModem::reset()
+{
+	assert(m_reset);
+
+	CThread::sleep(2000U);		// 2s
+	while (!open())
+		CThread::sleep(5000U);	// 5s
+
+	m_reset = false;
 }
 
 void CModem::close()
@@ -1186,11 +1290,16 @@ void CModem::close()
 
 	::LogMessage("Closing the MMDVM");
 
+	printStats();
+
 	m_port->close();
 }
 
 unsigned int CModem::readDStarData(unsigned char* data)
 {
+	if constexpr (!hasModemMode(MODEM_DSTAR))
+		return 0U;
+
 	assert(data != NULL);
 
 	if (m_rxDStarData.isEmpty())
@@ -1205,6 +1314,9 @@ unsigned int CModem::readDStarData(unsigned char* data)
 
 unsigned int CModem::readDMRData1(unsigned char* data)
 {
+	if constexpr (!hasModemMode(MODEM_DMR))
+		return 0U;
+
 	assert(data != NULL);
 
 	if (m_rxDMRData1.isEmpty())
@@ -1219,6 +1331,9 @@ unsigned int CModem::readDMRData1(unsigned char* data)
 
 unsigned int CModem::readDMRData2(unsigned char* data)
 {
+	if constexpr (!hasModemMode(MODEM_DMR))
+		return 0U;
+
 	assert(data != NULL);
 
 	if (m_rxDMRData2.isEmpty())
@@ -1233,6 +1348,9 @@ unsigned int CModem::readDMRData2(unsigned char* data)
 
 unsigned int CModem::readYSFData(unsigned char* data)
 {
+	if constexpr (!hasModemMode(MODEM_YSF))
+		return 0U;
+
 	assert(data != NULL);
 
 	if (m_rxYSFData.isEmpty())
@@ -1247,6 +1365,9 @@ unsigned int CModem::readYSFData(unsigned char* data)
 
 unsigned int CModem::readP25Data(unsigned char* data)
 {
+	if constexpr (!hasModemMode(MODEM_P25))
+		return 0U;
+
 	assert(data != NULL);
 
 	if (m_rxP25Data.isEmpty())
@@ -1261,6 +1382,9 @@ unsigned int CModem::readP25Data(unsigned char* data)
 
 unsigned int CModem::readNXDNData(unsigned char* data)
 {
+	if constexpr (!hasModemMode(MODEM_NXDN))
+		return 0U;
+
 	assert(data != NULL);
 
 	if (m_rxNXDNData.isEmpty())
@@ -1289,6 +1413,9 @@ unsigned int CModem::readM17Data(unsigned char* data)
 
 unsigned int CModem::readFMData(unsigned char* data)
 {
+	if constexpr (!hasModemMode(MODEM_FM))
+		return 0U;
+
 	assert(data != NULL);
 
 	if (m_rxFMData.isEmpty())
@@ -1303,6 +1430,9 @@ unsigned int CModem::readFMData(unsigned char* data)
 
 unsigned int CModem::readAX25Data(unsigned char* data)
 {
+	if constexpr (!hasModemMode(MODEM_AX25))
+		return 0U;
+
 	assert(data != NULL);
 
 	if (m_rxAX25Data.isEmpty())
@@ -1345,6 +1475,9 @@ unsigned int CModem::readSerial(unsigned char* data, unsigned int length)
 
 bool CModem::hasDStarSpace() const
 {
+	if constexpr (!hasModemMode(MODEM_DSTAR))
+		return false;
+
 	unsigned int space = m_txDStarData.freeSpace() / (DSTAR_FRAME_LENGTH_BYTES + 4U);
 
 	return space > 1U;
@@ -1352,6 +1485,9 @@ bool CModem::hasDStarSpace() const
 
 bool CModem::writeDStarData(const unsigned char* data, unsigned int length)
 {
+	if constexpr (!hasModemMode(MODEM_DSTAR))
+		return false;
+
 	assert(data != NULL);
 	assert(length > 0U);
 
@@ -1386,6 +1522,9 @@ bool CModem::writeDStarData(const unsigned char* data, unsigned int length)
 
 bool CModem::hasDMRSpace1() const
 {
+	if constexpr (!hasModemMode(MODEM_DMR))
+		return false;
+
 	unsigned int space = m_txDMRData1.freeSpace() / (DMR_FRAME_LENGTH_BYTES + 4U);
 
 	return space > 1U;
@@ -1393,6 +1532,9 @@ bool CModem::hasDMRSpace1() const
 
 bool CModem::hasDMRSpace2() const
 {
+	if constexpr (!hasModemMode(MODEM_DMR))
+		return false;
+
 	unsigned int space = m_txDMRData2.freeSpace() / (DMR_FRAME_LENGTH_BYTES + 4U);
 
 	return space > 1U;
@@ -1400,6 +1542,9 @@ bool CModem::hasDMRSpace2() const
 
 bool CModem::writeDMRData1(const unsigned char* data, unsigned int length)
 {
+	if constexpr (!hasModemMode(MODEM_DMR))
+		return false;
+
 	assert(data != NULL);
 	assert(length > 0U);
 
@@ -1423,6 +1568,9 @@ bool CModem::writeDMRData1(const unsigned char* data, unsigned int length)
 
 bool CModem::writeDMRData2(const unsigned char* data, unsigned int length)
 {
+	if constexpr (!hasModemMode(MODEM_DMR))
+		return false;
+
 	assert(data != NULL);
 	assert(length > 0U);
 
@@ -1446,6 +1594,9 @@ bool CModem::writeDMRData2(const unsigned char* data, unsigned int length)
 
 bool CModem::hasYSFSpace() const
 {
+	if constexpr (!hasModemMode(MODEM_YSF))
+		return false;
+
 	unsigned int space = m_txYSFData.freeSpace() / (YSF_FRAME_LENGTH_BYTES + 4U);
 
 	return space > 1U;
@@ -1453,6 +1604,9 @@ bool CModem::hasYSFSpace() const
 
 bool CModem::writeYSFData(const unsigned char* data, unsigned int length)
 {
+	if constexpr (!hasModemMode(MODEM_YSF))
+		return false;
+
 	assert(data != NULL);
 	assert(length > 0U);
 
@@ -1476,6 +1630,9 @@ bool CModem::writeYSFData(const unsigned char* data, unsigned int length)
 
 bool CModem::hasP25Space() const
 {
+	if constexpr (!hasModemMode(MODEM_P25))
+		return false;
+
 	unsigned int space = m_txP25Data.freeSpace() / (P25_LDU_FRAME_LENGTH_BYTES + 4U);
 
 	return space > 1U;
@@ -1483,6 +1640,9 @@ bool CModem::hasP25Space() const
 
 bool CModem::writeP25Data(const unsigned char* data, unsigned int length)
 {
+	if constexpr (!hasModemMode(MODEM_P25))
+		return false;
+
 	assert(data != NULL);
 	assert(length > 0U);
 
@@ -1506,6 +1666,9 @@ bool CModem::writeP25Data(const unsigned char* data, unsigned int length)
 
 bool CModem::hasNXDNSpace() const
 {
+	if constexpr (!hasModemMode(MODEM_NXDN))
+		return false;
+
 	unsigned int space = m_txNXDNData.freeSpace() / (NXDN_FRAME_LENGTH_BYTES + 4U);
 
 	return space > 1U;
@@ -1513,6 +1676,9 @@ bool CModem::hasNXDNSpace() const
 
 bool CModem::writeNXDNData(const unsigned char* data, unsigned int length)
 {
+	if constexpr (!hasModemMode(MODEM_NXDN))
+		return false;
+
 	assert(data != NULL);
 	assert(length > 0U);
 
@@ -1577,6 +1743,9 @@ bool CModem::writeM17Data(const unsigned char* data, unsigned int length)
 
 bool CModem::hasPOCSAGSpace() const
 {
+	if constexpr (!hasModemMode(MODEM_POCSAG))
+		return false;
+
 	unsigned int space = m_txPOCSAGData.freeSpace() / (POCSAG_FRAME_LENGTH_BYTES + 4U);
 
 	return space > 1U;
@@ -1584,6 +1753,9 @@ bool CModem::hasPOCSAGSpace() const
 
 bool CModem::writePOCSAGData(const unsigned char* data, unsigned int length)
 {
+	if constexpr (!hasModemMode(MODEM_POCSAG))
+		return false;
+
 	assert(data != NULL);
 	assert(length > 0U);
 
@@ -1604,11 +1776,17 @@ bool CModem::writePOCSAGData(const unsigned char* data, unsigned int length)
 
 unsigned int CModem::getFMSpace() const
 {
+	if constexpr (!hasModemMode(MODEM_FM))
+		return 0U;
+
 	return m_txFMData.freeSpace();
 }
 
 bool CModem::writeFMData(const unsigned char* data, unsigned int length)
 {
+	if constexpr (!hasModemMode(MODEM_FM))
+		return false;
+
 	assert(data != NULL);
 	assert(length > 0U);
 
@@ -1638,6 +1816,9 @@ bool CModem::writeFMData(const unsigned char* data, unsigned int length)
 
 bool CModem::hasAX25Space() const
 {
+	if constexpr (!hasModemMode(MODEM_AX25))
+		return false;
+
 	unsigned int space = m_txAX25Data.freeSpace() / (AX25_MAX_FRAME_LENGTH_BYTES + 5U);
 
 	return space > 1U;
@@ -1645,6 +1826,9 @@ bool CModem::hasAX25Space() const
 
 bool CModem::writeAX25Data(const unsigned char* data, unsigned int length)
 {
+	if constexpr (!hasModemMode(MODEM_AX25))
+		return false;
+
 	assert(data != NULL);
 	assert(length > 0U);
 
@@ -1708,6 +1892,9 @@ bool CModem::writeTransparentData(const unsigned char* data, unsigned int length
 
 bool CModem::writeDStarInfo(const char* my1, const char* my2, const char* your, const char* type, const char* reflector)
 {
+	if constexpr (!hasModemMode(MODEM_DSTAR))
+		return false;
+
 	assert(m_port != NULL);
 	assert(my1 != NULL);
 	assert(my2 != NULL);
@@ -1732,11 +1919,14 @@ bool CModem::writeDStarInfo(const char* my1, const char* my2, const char* your,
 
 	::memcpy(buffer + 25U, reflector, DSTAR_LONG_CALLSIGN_LENGTH);
 
-	return m_port->write(buffer, 33U) != 33;
+	return writePort(buffer, 33U) != 33;
 }
 
 bool CModem::writeDMRInfo(unsigned int slotNo, const std::string& src, bool group, const std::string& dest, const char* type)
 {
+	if constexpr (!hasModemMode(MODEM_DMR))
+		return false;
+
 	assert(m_port != NULL);
 	assert(type != NULL);
 
@@ -1758,11 +1948,14 @@ bool CModem::writeDMRInfo(unsigned int slotNo, const std::string& src, bool grou
 
 	::memcpy(buffer + 46U, type, 1U);
 
-	return m_port->write(buffer, 47U) != 47;
+	return writePort(buffer, 47U) != 47;
 }
 
 bool CModem::writeYSFInfo(const char* source, const char* dest, unsigned char dgid, const char* type, const char* origin)
 {
+	if constexpr (!hasModemMode(MODEM_YSF))
+		return false;
+
 	assert(m_port != NULL);
 	assert(source != NULL);
 	assert(dest != NULL);
@@ -1786,11 +1979,14 @@ bool CModem::writeYSFInfo(const char* source, const char* dest, unsigned char dg
 
 	buffer[35U] = dgid;
 
-	return m_port->write(buffer, 36U) != 36;
+	return writePort(buffer, 36U) != 36;
 }
 
 bool CModem::writeP25Info(const char* source, bool group, unsigned int dest, const char* type)
 {
+	if constexpr (!hasModemMode(MODEM_P25))
+		return false;
+
 	assert(m_port != NULL);
 	assert(source != NULL);
 	assert(type != NULL);
@@ -1811,11 +2007,14 @@ bool CModem::writeP25Info(const char* source, bool group, unsigned int dest, con
 
 	::memcpy(buffer + 30U, type, 1U);
 
-	return m_port->write(buffer, 31U) != 31;
+	return writePort(buffer, 31U) != 31;
 }
 
 bool CModem::writeNXDNInfo(const char* source, bool group, unsigned int dest, const char* type)
 {
+	if constexpr (!hasModemMode(MODEM_NXDN))
+		return false;
+
 	assert(m_port != NULL);
 	assert(source != NULL);
 	assert(type != NULL);
@@ -1836,7 +2035,7 @@ bool CModem::writeNXDNInfo(const char* source, bool group, unsigned int dest, co
 
 	::memcpy(buffer + 30U, type, 1U);
 
-	return m_port->write(buffer, 31U) != 31;
+	return writePort(buffer, 31U) != 31;
 }
 
 bool CModem::writeM17Info(const char* source, const char* dest, const char* type)
@@ -1860,11 +2059,14 @@ bool CModem::writeM17Info(const char* source, const char* dest, const char* type
 
 	::memcpy(buffer + 22U, type, 1U);
 
-	return m_port->write(buffer, 23U) != 23;
+	return writePort(buffer, 23U) != 23;
 }
 
 bool CModem::writePOCSAGInfo(unsigned int ric, const std::string& message)
 {
+	if constexpr (!hasModemMode(MODEM_POCSAG))
+		return false;
+
 	assert(m_port != NULL);
 
 	size_t length = message.size();
@@ -1881,7 +2083,7 @@ bool CModem::writePOCSAGInfo(unsigned int ric, const std::string& message)
 
 	::memcpy(buffer + 11U, message.c_str(), length);
 
-	int ret = m_port->write(buffer, (unsigned int)length + 11U);
+	int ret = writePort(buffer, (unsigned int)length + 11U);
 
 	return ret != int(length + 11U);
 }
@@ -1902,7 +2104,7 @@ bool CModem::writeIPInfo(const std::string& address)
 
 	::memcpy(buffer + 4U, address.c_str(), length);
 
-	int ret = m_port->write(buffer, (unsigned int)length + 4U);
+	int ret = writePort(buffer, (unsigned int)length + 4U);
 
 	return ret != int(length + 4U);
 }
@@ -1950,47 +2152,47 @@ bool CModem::hasError() const
 
 bool CModem::hasDStar() const
 {
-	return (m_capabilities1 & CAP1_DSTAR) == CAP1_DSTAR;
+	return hasModemMode(MODEM_DSTAR) && (m_capabilities1 & CAP1_DSTAR) == CAP1_DSTAR;
 }
 
 bool CModem::hasDMR() const
 {
-	return (m_capabilities1 & CAP1_DMR) == CAP1_DMR;
+	return hasModemMode(MODEM_DMR) && (m_capabilities1 & CAP1_DMR) == CAP1_DMR;
 }
 
 bool CModem::hasYSF() const
 {
-	return (m_capabilities1 & CAP1_YSF) == CAP1_YSF;
+	return hasModemMode(MODEM_YSF) && (m_capabilities1 & CAP1_YSF) == CAP1_YSF;
 }
 
 bool CModem::hasP25() const
 {
-	return (m_capabilities1 & CAP1_P25) == CAP1_P25;
+	return hasModemMode(MODEM_P25) && (m_capabilities1 & CAP1_P25) == CAP1_P25;
 }
 
 bool CModem::hasNXDN() const
 {
-	return (m_capabilities1 & CAP1_NXDN) == CAP1_NXDN;
+	return hasModemMode(MODEM_NXDN) && (m_capabilities1 & CAP1_NXDN) == CAP1_NXDN;
 }
 
 bool CModem::hasM17() const
 {
-	return (m_capabilities1 & CAP1_M17) == CAP1_M17;
+	return hasModemMode(MODEM_M17) && (m_capabilities1 & CAP1_M17) == CAP1_M17;
 }
 
 bool CModem::hasFM() const
 {
-	return (m_capabilities1 & CAP1_FM) == CAP1_FM;
+	return hasModemMode(MODEM_FM) && (m_capabilities1 & CAP1_FM) == CAP1_FM;
 }
 
 bool CModem::hasPOCSAG() const
 {
-	return (m_capabilities2 & CAP2_POCSAG) == CAP2_POCSAG;
+	return hasModemMode(MODEM_POCSAG) && (m_capabilities2 & CAP2_POCSAG) == CAP2_POCSAG;
 }
 
 bool CModem::hasAX25() const
 {
-	return (m_capabilities2 & CAP2_AX25) == CAP2_AX25;
+	return hasModemMode(MODEM_AX25) && (m_capabilities2 & CAP2_AX25) == CAP2_AX25;
 }
 
 unsigned int CModem::getVersion() const
@@ -1998,6 +2200,13 @@ unsigned int CModem::getVersion() const
 	return m_protocolVersion;
 }
 
+int CModem::getPortFD() const
+{
+	assert(m_port != NULL);
+
+	return m_port->getFD();
+}
+
 bool CModem::readVersion()
 {
 	assert(m_port != NULL);
@@ -2013,7 +2222,7 @@ bool CModem::readVersion()
 
 		// CUtils::dump(1U, "Written", buffer, 3U);
 
-		int ret = m_port->write(buffer, 3U);
+		int ret = writePort(buffer, 3U);
 		if (ret != 3)
 			return false;
 
@@ -2127,7 +2336,64 @@ bool CModem::readStatus()
 
 	// CUtils::dump(1U, "Written", buffer, 3U);
 
-	return m_port->write(buffer, 3U) == 3;
+	if (writePort(buffer, 3U) != 3)
+		return false;
+
+	// Timed from the oldest poll still waiting for a reply
+	if (m_statusSent == 0U)
+		m_statusSent = getNS();
+
+	return true;
+}
+
+void CModem::statusArrived()
+{
+	if (m_statusSent == 0U)
+		return;
+
+	uint64_t elapsed = getNS() - m_statusSent;
+	m_statusSent = 0U;
+
+	m_statusReplies++;
+	m_statusTime += elapsed;
+	if (elapsed > m_statusMax)
+		m_statusMax = elapsed;
+}
+
+void CModem::streamArrived()
+{
+	uint64_t now = getNS();
+
+	// How far this frame is from the modem's 40ms cadence, which is how much the port held it up or bunched it with others
+	if (m_lastStream != 0U) {
+		int64_t error = int64_t(now - m_lastStream) - int64_t(M17_FRAME_TIME_NS);
+		uint64_t absError = uint64_t(std::llabs(error));
+
+		m_streamFrames++;
+		m_streamError += absError;
+		if (absError > m_streamMax)
+			m_streamMax = absError;
+	}
+
+	m_lastStream = now;
+}
+
+void CModem::printStats()
+{
+	if (m_statusReplies > 0U)
+		LogMessage("Modem status polls: %u, %.1f ms average, %.1f ms maximum to the reply", m_statusReplies,
+			double(m_statusTime) / double(m_statusReplies) / 1000000.0, double(m_statusMax) / 1000000.0);
+
+	if (m_streamFrames > 0U)
+		LogMessage("Modem M17 frames: %u, %.1f ms average, %.1f ms maximum away from the 40 ms cadence", m_streamFrames,
+			double(m_streamError) / double(m_streamFrames) / 1000000.0, double(m_streamMax) / 1000000.0);
+
+	m_statusReplies = 0U;
+	m_statusTime    = 0U;
+	m_statusMax     = 0U;
+	m_streamFrames  = 0U;
+	m_streamError   = 0U;
+	m_streamMax     = 0U;
 }
 
 bool CModem::writeConfig()
@@ -2226,7 +2492,7 @@ bool CModem::setConfig1()
 
 	// CUtils::dump(1U, "Written", buffer, 26U);
 
-	int ret = m_port->write(buffer, 26U);
+	int ret = writePort(buffer, 26U);
 	if (ret != 26)
 		return false;
 
@@ -2352,7 +2618,7 @@ bool CModem::setConfig2()
 
 	// CUtils::dump(1U, "Written", buffer, 40U);
 
-	int ret = m_port->write(buffer, 40U);
+	int ret = writePort(buffer, 40U);
 	if (ret != 40)
 		return false;
 
@@ -2427,7 +2693,7 @@ bool CModem::setFrequency()
 
 	// CUtils::dump(1U, "Written", buffer, len);
 
-	int ret = m_port->write(buffer, len);
+	int ret = writePort(buffer, len);
 	if (ret != len)
 		return false;
 
@@ -2460,82 +2726,71 @@ RESP_TYPE_MMDVM CModem::getResponse()
 {
 	assert(m_port != NULL);
 
-	if (m_state == SS_START) {
-		// Get the start of the frame or nothing at all
-		int ret = m_port->read(m_buffer + 0U, 1U);
-		if (ret < 0) {
-			LogError("Error when reading from the modem");
-			return RTM_ERROR;
-		}
-
-		if (ret == 0)
-			return RTM_TIMEOUT;
-
-		if (m_buffer[0U] != MMDVM_FRAME_START)
-			return RTM_TIMEOUT;
+	for (;;) {
+		if (m_state == SS_START) {
+			// Skip anything up to the start of a frame, or find nothing at all
+			do {
+				int ret = readPort(m_buffer + 0U, 1U);
+				if (ret < 0) {
+					LogError("Error when reading from the modem");
+					return RTM_ERROR;
+				}
 
-		m_state  = SS_LENGTH1;
-		m_length = 1U;
-	}
+				if (ret == 0)
+					return RTM_TIMEOUT;
+			} while (m_buffer[0U] != MMDVM_FRAME_START);
 
-	if (m_state == SS_LENGTH1) {
-		// Get the length of the frame, 1/2
-		int ret = m_port->read(m_buffer + 1U, 1U);
-		if (ret < 0) {
-			LogError("Error when reading from the modem");
-			m_state = SS_START;
-			return RTM_ERROR;
+			m_state  = SS_LENGTH1;
+			m_length = 1U;
 		}
 
-		if (ret == 0)
-			return RTM_TIMEOUT;
+		if (m_state == SS_LENGTH1) {
+			// Get the length of the frame, 1/2
+			int ret = readPort(m_buffer + 1U, 1U);
+			if (ret < 0) {
+				LogError("Error when reading from the modem");
+				m_state = SS_START;
+				return RTM_ERROR;
+			}
 
-		m_length = m_buffer[1U];
-		m_offset = 2U;
+			if (ret == 0)
+				return RTM_TIMEOUT;
 
-		if (m_length == 0U)
-			m_state = SS_LENGTH2;
-		else
-			m_state = SS_TYPE;
-	}
+			m_length = m_buffer[1U];
+			m_offset = 2U;
 
-	if (m_state == SS_LENGTH2) {
-		// Get the length of the frane, 2/2
-		int ret = m_port->read(m_buffer + 2U, 1U);
-		if (ret < 0) {
-			LogError("Error when reading from the modem");
-			m_state = SS_START;
-			return RTM_ERROR;
+			if (m_length == 0U) {
+				m_state = SS_LENGTH2;
+			} else if (m_length < 3U) {
+				// Not a real frame start, look for the next one
+				LogDebug("Invalid frame length of %u from the modem, resynchronising", m_length);
+				m_state = SS_START;
+				continue;
+			} else {
+				m_state = SS_TYPE;
+			}
 		}
 
-		if (ret == 0)
-			return RTM_TIMEOUT;
+		if (m_state == SS_LENGTH2) {
+			// Get the length of the frame, 2/2
+			int ret = readPort(m_buffer + 2U, 1U);
+			if (ret < 0) {
+				LogError("Error when reading from the modem");
+				m_state = SS_START;
+				return RTM_ERROR;
+			}
 
-		m_length = m_buffer[2U] + 255U;
-		m_offset = 3U;
-		m_state  = SS_TYPE;
-	}
+			if (ret == 0)
+				return RTM_TIMEOUT;
 
-	if (m_state == SS_TYPE) {
-		// Get the frame type
-		int ret = m_port->read(&m_type, 1U);
-		if (ret < 0) {
-			LogError("Error when reading from the modem");
-			m_state = SS_START;
-			return RTM_ERROR;
+			m_length = m_buffer[2U] + 255U;
+			m_offset = 3U;
+			m_state  = SS_TYPE;
 		}
 
-		if (ret == 0)
-			return RTM_TIMEOUT;
-
-		m_buffer[m_offset++] = m_type;
-
-		m_state = SS_DATA;
-	}
-
-	if (m_state == SS_DATA) {
-		while (m_offset < m_length) {
-			int ret = m_port->read(m_buffer + m_offset, m_length - m_offset);
+		if (m_state == SS_TYPE) {
+			// Get the frame type
+			int ret = readPort(&m_type, 1U);
 			if (ret < 0) {
 				LogError("Error when reading from the modem");
 				m_state = SS_START;
@@ -2545,17 +2800,72 @@ RESP_TYPE_MMDVM CModem::getResponse()
 			if (ret == 0)
 				return RTM_TIMEOUT;
 
-			if (ret > 0)
+			m_buffer[m_offset++] = m_type;
+
+			m_state = SS_DATA;
+		}
+
+		if (m_state == SS_DATA) {
+			// A partial frame stays here until the rest of it arrives
+			while (m_offset < m_length) {
+				int ret = readPort(m_buffer + m_offset, m_length - m_offset);
+				if (ret < 0) {
+					LogError("Error when reading from the modem");
+					m_state = SS_START;
+					return RTM_ERROR;
+				}
+
+				if (ret == 0)
+					return RTM_TIMEOUT;
+
 				m_offset += ret;
+			}
 		}
+
+		// CUtils::dump(1U, "Received", m_buffer, m_length);
+
+		if (m_capture != NULL)
+			m_capture->write(CD_RX, m_buffer, m_length);
+
+		m_offset = m_length > 255U ? 4U : 3U;
+		m_state  = SS_START;
+
+		return RTM_OK;
+	}
+}
+
+int CModem::readPort(unsigned char* data, unsigned int length)
+{
+	assert(data != NULL);
+
+	// Refill from the port with a single read of everything that is pending
+	if (m_readPtr >= m_readLength) {
+		int ret = m_port->readAvailable(m_readBuffer, BUFFER_LENGTH);
+		if (ret <= 0)
+			return ret;
+
+		m_readLength = (unsigned int)ret;
+		m_readPtr    = 0U;
 	}
 
-	// CUtils::dump(1U, "Received", m_buffer, m_length);
+	unsigned int n = m_readLength - m_readPtr;
+	if (n > length)
+		n = length;
 
-	m_offset = m_length > 255U ? 4U : 3U;
-	m_state  = SS_START;
+	::memcpy(data, m_readBuffer + m_readPtr, n);
+	m_readPtr += n;
 
-	return RTM_OK;
+	return int(n);
+}
+
+int CModem::writePort(const unsigned char* data, unsigned int length)
+{
+	assert(data != NULL);
+
+	if (m_capture != NULL)
+		m_capture->write(CD_TX, data, length);
+
+	return m_port->write(data, length);
 }
 
 HW_TYPE CModem::getHWType() const
@@ -2581,7 +2891,7 @@ bool CModem::setMode(unsigned char mode)
 
 	// CUtils::dump(1U, "Written", buffer, 4U);
 
-	return m_port->write(buffer, 4U) == 4;
+	return writePort(buffer, 4U) == 4;
 }
 
 bool CModem::sendCWId(const std::string& callsign)
@@ -2603,11 +2913,14 @@ bool CModem::sendCWId(const std::string& callsign)
 
 	// CUtils::dump(1U, "Written", buffer, length + 3U);
 
-	return m_port->write(buffer, length + 3U) == int(length + 3U);
+	return writePort(buffer, length + 3U) == int(length + 3U);
 }
 
 bool CModem::writeDMRStart(bool tx)
 {
+	if constexpr (!hasModemMode(MODEM_DMR))
+		return false;
+
 	assert(m_port != NULL);
 
 	if (tx && m_tx)
@@ -2624,11 +2937,14 @@ bool CModem::writeDMRStart(bool tx)
 
 	// CUtils::dump(1U, "Written", buffer, 4U);
 
-	return m_port->write(buffer, 4U) == 4;
+	return writePort(buffer, 4U) == 4;
 }
 
 bool CModem::writeDMRAbort(unsigned int slotNo)
 {
+	if constexpr (!hasModemMode(MODEM_DMR))
+		return false;
+
 	assert(m_port != NULL);
 
 	if (slotNo == 1U)
@@ -2645,11 +2961,14 @@ bool CModem::writeDMRAbort(unsigned int slotNo)
 
 	// CUtils::dump(1U, "Written", buffer, 4U);
 
-	return m_port->write(buffer, 4U) == 4;
+	return writePort(buffer, 4U) == 4;
 }
 
 bool CModem::writeDMRShortLC(const unsigned char* lc)
 {
+	if constexpr (!hasModemMode(MODEM_DMR))
+		return false;
+
 	assert(m_port != NULL);
 	assert(lc != NULL);
 
@@ -2670,7 +2989,7 @@ bool CModem::writeDMRShortLC(const unsigned char* lc)
 
 	// CUtils::dump(1U, "Written", buffer, 12U);
 
-	return m_port->write(buffer, 12U) == 12;
+	return writePort(buffer, 12U) == 12;
 }
 
 void CModem::setFMCallsignParams(const std::string& callsign, unsigned int callsignSpeed, unsigned int callsignFrequency, unsigned int callsignTime, unsigned int callsignHoldoff, float callsignHighLevel, float callsignLowLevel, bool callsignAtStart, bool callsignAtEnd, bool callsignAtLatch)
@@ -2761,7 +3080,7 @@ bool CModem::setFMCallsignParams()
 
 	// CUtils::dump(1U, "Written", buffer, len);
 
-	int ret = m_port->write(buffer, len);
+	int ret = writePort(buffer, len);
 	if (ret != len)
 		return false;
 
@@ -2813,7 +3132,7 @@ bool CModem::setFMAckParams()
 
 	// CUtils::dump(1U, "Written", buffer, len);
 
-	int ret = m_port->write(buffer, len);
+	int ret = writePort(buffer, len);
 	if (ret != len)
 		return false;
 
@@ -2880,7 +3199,7 @@ bool CModem::setFMMiscParams()
 
 	// CUtils::dump(1U, "Written", buffer, 17U);
 
-	int ret = m_port->write(buffer, 17U);
+	int ret = writePort(buffer, 17U);
 	if (ret != 17)
 		return false;
 
@@ -2931,7 +3250,7 @@ bool CModem::setFMExtParams()
 
 	// CUtils::dump(1U, "Written", buffer, len);
 
-	int ret = m_port->write(buffer, len);
+	int ret = writePort(buffer, len);
 	if (ret != len)
 		return false;
 
@@ -19,13 +19,39 @@
 #ifndef	Modem_H
 #define	Modem_H
 
+#include "ModemCapture.h"
 #include "ModemPort.h"
 #include "RingBuffer.h"
 #include "Defines.h"
 #include "Timer.h"
 
+#include <cstdint>
 #include <string>
 
+// The modes that CModem is built with, the rest are compiled out along with
+// their buffers. M17Client only ever uses M17, define MODEM_ALL_MODES to get
+// the full modem back.
+const unsigned int MODEM_DSTAR  = 0x0001U;
+const unsigned int MODEM_DMR    = 0x0002U;
+const unsigned int MODEM_YSF    = 0x0004U;
+const unsigned int MODEM_P25    = 0x0008U;
+const unsigned int MODEM_NXDN   = 0x0010U;
+const unsigned int MODEM_M17    = 0x0020U;
+const unsigned int MODEM_POCSAG = 0x0040U;
+const unsigned int MODEM_FM     = 0x0080U;
+const unsigned int MODEM_AX25   = 0x0100U;
+
+#if defined(MODEM_ALL_MODES)
+constexpr unsigned int MODEM_MODES = MODEM_DSTAR | MODEM_DMR | MODEM_YSF | MODEM_P25 | MODEM_NXDN | MODEM_M17 | MODEM_POCSAG | MODEM_FM | MODEM_AX25;
+#else
+constexpr unsigned int MODEM_MODES = MODEM_M17;
+#endif
+
+constexpr bool hasModemMode(unsigned int mode)
+{
+	return (MODEM_MODES & mode) == mode;
+}
+
 enum RESP_TYPE_MMDVM {
 	RTM_OK,
 	RTM_TIMEOUT,
@@ -46,6 +72,8 @@ public:
 	~CModem();
 
 	void setPort(IModemPort* port);
+	// The capture is not owned by the modem
+	void setCapture(CModemCapture* capture);
 	void setRFParams(unsigned int rxFrequency, int rxOffset, bool rxInvert, unsigned int txFrequency, int txOffset, bool txInvert, int txDCOffset, int rxDCOffset, float rfLevel, unsigned int pocsagFrequency);
 	void setModeParams(bool dstarEnabled, bool dmrEnabled, bool ysfEnabled, bool p25Enabled, bool nxdnEnabled, bool m17Enabled, bool pocsagEnabled, bool fmEnabled, bool ax25Enabled, unsigned char mode = MODE_IDLE);
 	void setLevels(float rxLevel, float cwIdTXLevel, float dstarTXLevel, float dmrTXLevel, float ysfTXLevel, float p25TXLevel, float nxdnTXLevel, float m17TXLevel, float pocsagLevel, float fmTXLevel, float ax25TXLevel);
@@ -77,6 +105,8 @@ public:
 
 	unsigned int getVersion() const;
 
+	int getPortFD() const;
+
 	unsigned int readDStarData(unsigned char* data);
 	unsigned int readDMRData1(unsigned char* data);
 	unsigned int readDMRData2(unsigned char* data);
@@ -144,6 +174,11 @@ public:
 
 	void clock(unsigned int ms);
 
+	// After a period of silence clock() closes the port, reset() then reopens
+	// it, which can take seconds and gives the port a new descriptor
+	bool needsReset() const;
+	void reset();
+
 	void close();
 
 private:
@@ -190,10 +225,14 @@ private:
 	int                        m_rxDCOffset;
 	int                        m_txDCOffset;
 	IModemPort*                m_port;
+	CModemCapture*             m_capture;
 	unsigned char*             m_buffer;
 	unsigned int               m_length;
 	unsigned int               m_offset;
 	SERIAL_STATE               m_state;
+	unsigned char*             m_readBuffer;
+	unsigned int               m_readLength;
+	unsigned int               m_readPtr;
 	unsigned char              m_type;
 	CRingBuffer<unsigned char> m_rxDStarData;
 	CRingBuffer<unsigned char> m_txDStarData;
@@ -222,6 +261,15 @@ private:
 	CTimer                     m_statusTimer;
 	CTimer                     m_inactivityTimer;
 	CTimer                     m_playoutTimer;
+	CTimer                     m_statsTimer;
+	uint64_t                   m_statusSent;
+	unsigned int               m_statusReplies;
+	uint64_t                   m_statusTime;
+	uint64_t                   m_statusMax;
+	uint64_t                   m_lastStream;
+	unsigned int               m_streamFrames;
+	uint64_t                   m_streamError;
+	uint64_t                   m_streamMax;
 	unsigned int               m_dstarSpace;
 	unsigned int               m_dmrSpace1;
 	unsigned int               m_dmrSpace2;
@@ -236,6 +284,7 @@ private:
 	bool                       m_cd;
 	bool                       m_lockout;
 	bool                       m_error;
+	bool                       m_reset;
 	unsigned char              m_mode;
 	HW_TYPE                    m_hwType;
 	int                        m_ax25RXTwist;
@@ -282,6 +331,9 @@ private:
 
 	bool readVersion();
 	bool readStatus();
+	void statusArrived();
+	void streamArrived();
+	void printStats();
 	bool setConfig1();
 	bool setConfig2();
 	bool setFrequency();
@@ -293,6 +345,10 @@ private:
 	void printDebug();
 
 	RESP_TYPE_MMDVM getResponse();
+
+	int readPort(unsigned char* data, unsigned int length);
+
+	int writePort(const unsigned char* data, unsigned int length);
 };
 
 #endif
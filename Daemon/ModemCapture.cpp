@@ -0,0 +1,384 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "ModemCapture.h"
+#include "Log.h"
+
+#include <cassert>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+const unsigned char CAPTURE_MAGIC[] = {'M', '1', '7', 'C', 'A', 'P', '0', '1'};
+const unsigned int  CAPTURE_MAGIC_LENGTH = 8U;
+
+// The magic, the data size, head, tail and the wrapped flag
+const unsigned int CAPTURE_HEADER_LENGTH = 64U;
+
+// The length, direction, spare and timestamp
+const unsigned int RECORD_HEADER_LENGTH = 12U;
+
+const unsigned int MAX_FRAME_LENGTH = 1024U;
+
+const unsigned int FLUSH_INTERVAL = 1000U;
+const unsigned int STOP_INTERVAL  = 100U;
+
+static void writeLE(unsigned char* p, uint64_t value, unsigned int n)
+{
+	for (unsigned int i = 0U; i < n; i++)
+		p[i] = (value >> (i * 8U)) & 0xFFU;
+}
+
+static uint64_t readLE(const unsigned char* p, unsigned int n)
+{
+	uint64_t value = 0U;
+	for (unsigned int i = 0U; i < n; i++)
+		value |= uint64_t(p[i]) << (i * 8U);
+
+	return value;
+}
+
+CModemCapture::CModemCapture(const std::string& file, unsigned int size) :
+CThread(),
+m_file(file),
+m_size(size),
+m_fd(-1),
+m_map(NULL),
+m_data(NULL),
+m_dataSize(0U),
+m_head(0U),
+m_tail(0U),
+m_wrapped(false),
+m_writing(false),
+m_stop(false)
+{
+	assert(!file.empty());
+}
+
+CModemCapture::~CModemCapture()
+{
+}
+
+bool CModemCapture::open()
+{
+	if (m_size <= (CAPTURE_HEADER_LENGTH + RECORD_HEADER_LENGTH + MAX_FRAME_LENGTH)) {
+		LogError("The capture file size of %u bytes is too small", m_size);
+		return false;
+	}
+
+	// The last run's capture is kept, as a crash or a restart is when it is wanted
+	if (!rotate())
+		return false;
+
+	m_fd = ::open(m_file.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+	if (m_fd < 0) {
+		LogError("Cannot open the capture file %s, err=%d", m_file.c_str(), errno);
+		return false;
+	}
+
+	// Allocate the whole file now so that a full disk cannot fault the mapping later
+	int ret = ::posix_fallocate(m_fd, 0, m_size);
+	if (ret != 0) {
+		LogError("Cannot allocate %u bytes for the capture file %s, err=%d", m_size, m_file.c_str(), ret);
+		::close(m_fd);
+		m_fd = -1;
+		return false;
+	}
+
+	int flags = MAP_SHARED;
+#if defined(MAP_POPULATE)
+	flags |= MAP_POPULATE;
+#endif
+
+	void* map = ::mmap(NULL, m_size, PROT_READ | PROT_WRITE, flags, m_fd, 0);
+	if (map == MAP_FAILED) {
+		LogError("Cannot map the capture file %s, err=%d", m_file.c_str(), errno);
+		::close(m_fd);
+		m_fd = -1;
+		return false;
+	}
+
+	m_map      = (unsigned char*)map;
+	m_data     = m_map + CAPTURE_HEADER_LENGTH;
+	m_dataSize = m_size - CAPTURE_HEADER_LENGTH;
+	m_head     = 0U;
+	m_tail     = 0U;
+	m_wrapped  = false;
+	m_writing  = true;
+	m_stop     = false;
+
+	::memcpy(m_map, CAPTURE_MAGIC, CAPTURE_MAGIC_LENGTH);
+	writeHeader();
+
+	if (!run()) {
+		LogError("Cannot start the capture flushing thread");
+		m_writing = false;
+		close();
+		return false;
+	}
+
+	LogMessage("Capturing modem frames to %s, %u bytes", m_file.c_str(), m_size);
+
+	return true;
+}
+
+void CModemCapture::write(CAPTURE_DIRECTION direction, const unsigned char* data, unsigned int length)
+{
+	assert(data != NULL);
+
+	if (!m_writing)
+		return;
+
+	if (length > MAX_FRAME_LENGTH)
+		length = MAX_FRAME_LENGTH;
+
+	unsigned int n = RECORD_HEADER_LENGTH + length;
+
+	// Make room by dropping the oldest records, wrapping the head at the end of the file
+	for (;;) {
+		if (m_wrapped) {
+			while (m_tail < (m_head + n)) {
+				unsigned int len = recordLength(m_tail);
+				if (len == 0U) {
+					m_tail    = 0U;
+					m_wrapped = false;
+					break;
+				}
+
+				m_tail += len;
+			}
+		}
+
+		if (m_wrapped || (m_head + n) <= m_dataSize)
+			break;
+
+		if ((m_head + 2U) <= m_dataSize)
+			writeLE(m_data + m_head, 0U, 2U);
+
+		if (m_tail == m_head) {
+			// Empty
+			m_tail = 0U;
+		} else {
+			m_wrapped = true;
+		}
+
+		m_head = 0U;
+	}
+
+	struct timespec now;
+	::clock_gettime(CLOCK_MONOTONIC, &now);
+	uint64_t timestamp = now.tv_sec * 1000000000ULL + now.tv_nsec;
+
+	unsigned char* p = m_data + m_head;
+	writeLE(p + 0U, n, 2U);
+	p[2U] = (unsigned char)direction;
+	p[3U] = 0x00U;
+	writeLE(p + 4U, timestamp, 8U);
+	::memcpy(p + RECORD_HEADER_LENGTH, data, length);
+
+	m_head += n;
+
+	writeHeader();
+}
+
+bool CModemCapture::openRead()
+{
+	m_fd = ::open(m_file.c_str(), O_RDONLY | O_CLOEXEC);
+	if (m_fd < 0) {
+		LogError("Cannot open the capture file %s, err=%d", m_file.c_str(), errno);
+		return false;
+	}
+
+	struct stat st;
+	if (::fstat(m_fd, &st) < 0 || st.st_size <= off_t(CAPTURE_HEADER_LENGTH)) {
+		LogError("The capture file %s is too short", m_file.c_str());
+		::close(m_fd);
+		m_fd = -1;
+		return false;
+	}
+
+	m_size = (unsigned int)st.st_size;
+
+	void* map = ::mmap(NULL, m_size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+	if (map == MAP_FAILED) {
+		LogError("Cannot map the capture file %s, err=%d", m_file.c_str(), errno);
+		::close(m_fd);
+		m_fd = -1;
+		return false;
+	}
+
+	m_map      = (unsigned char*)map;
+	m_data     = m_map + CAPTURE_HEADER_LENGTH;
+	m_writing  = false;
+
+	if (!readHeader()) {
+		LogError("The capture file %s is invalid", m_file.c_str());
+		close();
+		return false;
+	}
+
+	return true;
+}
+
+bool CModemCapture::read(CAPTURE_DIRECTION& direction, uint64_t& timestamp, unsigned char* data, unsigned int& length)
+{
+	assert(data != NULL);
+	assert(!m_writing);
+
+	if (m_map == NULL)
+		return false;
+
+	if (m_wrapped) {
+		unsigned int len = recordLength(m_tail);
+		if (len == 0U) {
+			m_tail    = 0U;
+			m_wrapped = false;
+		}
+	}
+
+	if (!m_wrapped && m_tail >= m_head)
+		return false;
+
+	unsigned int len = recordLength(m_tail);
+	if (len < RECORD_HEADER_LENGTH || (len - RECORD_HEADER_LENGTH) > MAX_FRAME_LENGTH) {
+		LogError("Corrupt record in the capture file at offset %u", m_tail);
+		return false;
+	}
+
+	const unsigned char* p = m_data + m_tail;
+	direction = CAPTURE_DIRECTION(p[2U]);
+	timestamp = readLE(p + 4U, 8U);
+	length    = len - RECORD_HEADER_LENGTH;
+	::memcpy(data, p + RECORD_HEADER_LENGTH, length);
+
+	m_tail += len;
+
+	return true;
+}
+
+void CModemCapture::close()
+{
+	if (m_writing) {
+		m_writing = false;
+		m_stop = true;
+		wait();
+
+		::msync(m_map, m_size, MS_SYNC);
+	}
+
+	if (m_map != NULL) {
+		::munmap(m_map, m_size);
+		m_map  = NULL;
+		m_data = NULL;
+	}
+
+	if (m_fd != -1) {
+		::close(m_fd);
+		m_fd = -1;
+	}
+}
+
+void CModemCapture::entry()
+{
+	unsigned int elapsed = 0U;
+
+	while (!m_stop) {
+		CThread::sleep(STOP_INTERVAL);
+
+		elapsed += STOP_INTERVAL;
+		if (elapsed >= FLUSH_INTERVAL) {
+			::msync(m_map, m_size, MS_SYNC);
+			elapsed = 0U;
+		}
+	}
+}
+
+bool CModemCapture::isCapture(const std::string& file)
+{
+	FILE* fp = ::fopen(file.c_str(), "rb");
+	if (fp == NULL)
+		return false;
+
+	unsigned char magic[CAPTURE_MAGIC_LENGTH];
+	size_t n = ::fread(magic, 1U, CAPTURE_MAGIC_LENGTH, fp);
+
+	::fclose(fp);
+
+	return n == CAPTURE_MAGIC_LENGTH && ::memcmp(magic, CAPTURE_MAGIC, CAPTURE_MAGIC_LENGTH) == 0;
+}
+
+bool CModemCapture::rotate() const
+{
+	struct stat st;
+	if (::stat(m_file.c_str(), &st) < 0)
+		return true;
+
+	// Nothing was written to an empty file, so it can simply be reused
+	if (st.st_size == 0)
+		return true;
+
+	if (!isCapture(m_file)) {
+		LogError("%s exists and is not a capture file, not overwriting it", m_file.c_str());
+		return false;
+	}
+
+	std::string old = m_file + ".1";
+	if (::rename(m_file.c_str(), old.c_str()) < 0) {
+		LogError("Cannot rename the capture file %s to %s, err=%d", m_file.c_str(), old.c_str(), errno);
+		return false;
+	}
+
+	LogMessage("Kept the previous capture as %s", old.c_str());
+
+	return true;
+}
+
+unsigned int CModemCapture::recordLength(unsigned int offset) const
+{
+	if ((offset + RECORD_HEADER_LENGTH) > m_dataSize)
+		return 0U;
+
+	return (unsigned int)readLE(m_data + offset, 2U);
+}
+
+void CModemCapture::writeHeader()
+{
+	writeLE(m_map + 8U,  m_dataSize, 4U);
+	writeLE(m_map + 12U, m_head, 4U);
+	writeLE(m_map + 16U, m_tail, 4U);
+	m_map[20U] = m_wrapped ? 1U : 0U;
+}
+
+bool CModemCapture::readHeader()
+{
+	if (::memcmp(m_map, CAPTURE_MAGIC, CAPTURE_MAGIC_LENGTH) != 0)
+		return false;
+
+	m_dataSize = (unsigned int)readLE(m_map + 8U,  4U);
+	m_head     = (unsigned int)readLE(m_map + 12U, 4U);
+	m_tail     = (unsigned int)readLE(m_map + 16U, 4U);
+	m_wrapped  = m_map[20U] == 1U;
+
+	return m_dataSize == (m_size - CAPTURE_HEADER_LENGTH) && m_head <= m_dataSize && m_tail <= m_dataSize;
+}
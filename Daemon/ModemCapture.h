@@ -0,0 +1,90 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(ModemCapture_H)
+#define	ModemCapture_H
+
+#include "Thread.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+enum CAPTURE_DIRECTION {
+	CD_RX,
+	CD_TX
+};
+
+/*
+ * Captures the raw MMDVM frames to and from the modem in a preallocated file
+ * that is mapped into memory and used as a ring, so that the oldest frames
+ * are overwritten once it is full. Writing a frame is a copy into the mapping,
+ * the kernel writes the pages back and a background thread flushes them to
+ * the disk once a second.
+ *
+ * The file starts with a header holding the positions of the oldest and the
+ * next record. Each record is a two byte length, which includes the record
+ * header, the direction, a spare byte, the CLOCK_MONOTONIC time in ns and the
+ * frame. All of the numbers are little endian. A zero length, or too little
+ * room for a record header, marks the point where the ring wraps.
+ *
+ * An existing capture is renamed to <file>.1 rather than overwritten, so the
+ * frames leading up to a crash or a restart survive it. They are not carried
+ * on in the same ring, as the timestamps start again after a reboot.
+ *
+ * The same class reads a capture back, oldest frame first.
+ */
+class CModemCapture : public CThread {
+public:
+	CModemCapture(const std::string& file, unsigned int size);
+	virtual ~CModemCapture();
+
+	bool open();
+
+	void write(CAPTURE_DIRECTION direction, const unsigned char* data, unsigned int length);
+
+	bool openRead();
+
+	bool read(CAPTURE_DIRECTION& direction, uint64_t& timestamp, unsigned char* data, unsigned int& length);
+
+	void close();
+
+	virtual void entry();
+
+	static bool isCapture(const std::string& file);
+
+private:
+	std::string       m_file;
+	unsigned int      m_size;
+	int               m_fd;
+	unsigned char*    m_map;
+	unsigned char*    m_data;
+	unsigned int      m_dataSize;
+	unsigned int      m_head;
+	unsigned int      m_tail;
+	bool              m_wrapped;
+	bool              m_writing;
+	std::atomic<bool> m_stop;
+
+	bool rotate() const;
+	unsigned int recordLength(unsigned int offset) const;
+	void writeHeader();
+	bool readHeader();
+};
+
+#endif
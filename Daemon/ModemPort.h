@@ -27,10 +27,19 @@ public:
 
 	virtual int read(unsigned char* buffer, unsigned int length) = 0;
 
+	// Return whatever has already arrived, up to length bytes, without waiting
+	virtual int readAvailable(unsigned char* buffer, unsigned int length) = 0;
+
 	virtual int write(const unsigned char* buffer, unsigned int length) = 0;
 
+	// Send anything that write() has held back to batch it with later writes
+	virtual bool flush() = 0;
+
 	virtual void close() = 0;
 
+	// The descriptor to wait on for incoming data, or -1 if there is none
+	virtual int getFD() const = 0;
+
 private:
 };
 
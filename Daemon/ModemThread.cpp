@@ -0,0 +1,240 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "ModemThread.h"
+#include "M17Defines.h"
+#include "StopWatch.h"
+#include "Log.h"
+
+#include <cassert>
+#include <cstring>
+
+const unsigned int MODEM_TICK = 5U;
+
+const unsigned int MAX_FRAME_LENGTH = M17_FRAME_LENGTH_BYTES + 4U;
+
+const unsigned int RX_QUEUE_LENGTH = 20U * (MAX_FRAME_LENGTH + 1U);
+const unsigned int TX_QUEUE_LENGTH = 5U  * (MAX_FRAME_LENGTH + 1U);
+
+CModemThread::CModemThread(CModem* modem, CEventLoop& mainLoop) :
+CThread(),
+m_modem(modem),
+m_mainLoop(mainLoop),
+m_loop(),
+m_rxQueue(RX_QUEUE_LENGTH, "Modem thread RX"),
+m_txQueue(TX_QUEUE_LENGTH, "Modem thread TX"),
+m_m17Space(false),
+m_stop(false),
+m_mutex(),
+m_resetting(false),
+m_fd(-1)
+{
+	assert(modem != NULL);
+}
+
+CModemThread::~CModemThread()
+{
+}
+
+bool CModemThread::start()
+{
+	bool ret = m_loop.open();
+	if (!ret)
+		return false;
+
+	m_fd = m_modem->getPortFD();
+	if (m_fd >= 0)
+		m_loop.addFD(m_fd);
+
+	m_loop.setTick(MODEM_TICK);
+
+	m_m17Space = m_modem->hasM17Space();
+	m_stop     = false;
+
+	ret = run();
+	if (!ret) {
+		LogError("Unable to start the modem thread");
+		m_loop.close();
+		return false;
+	}
+
+	LogMessage("Started the modem thread");
+
+	return true;
+}
+
+bool CModemThread::hasM17Space() const
+{
+	return m_m17Space && m_txQueue.hasSpace(MAX_FRAME_LENGTH + 1U);
+}
+
+bool CModemThread::writeM17Data(const unsigned char* data, unsigned int length)
+{
+	assert(data != NULL);
+	assert(length > 0U && length <= MAX_FRAME_LENGTH);
+
+	if (!m_txQueue.hasSpace(length + 1U))
+		return false;
+
+	if (!addRecord(m_txQueue, data, length))
+		return false;
+
+	m_loop.signal();
+
+	return true;
+}
+
+unsigned int CModemThread::readM17Data(unsigned char* data)
+{
+	assert(data != NULL);
+
+	return getRecord(m_rxQueue, data);
+}
+
+bool CModemThread::changeFrequency(unsigned int rxFrequency, int rxOffset, bool rxInvert, unsigned int txFrequency, int txOffset, bool txInvert)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if (m_resetting) {
+		LogWarning("Cannot change the frequency while the modem is being reset");
+		return false;
+	}
+
+	return m_modem->changeFrequency(rxFrequency, rxOffset, rxInvert, txFrequency, txOffset, txInvert);
+}
+
+void CModemThread::stop()
+{
+	m_stop = true;
+	m_loop.signal();
+
+	wait();
+
+	m_loop.close();
+
+	LogMessage("Stopped the modem thread");
+}
+
+void CModemThread::entry()
+{
+	unsigned char data[MAX_FRAME_LENGTH];
+
+	CStopWatch stopWatch;
+	stopWatch.start();
+
+	while (!m_stop) {
+		bool received = false;
+		bool needReset = false;
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			unsigned int len;
+			while (m_modem->hasM17Space() && (len = getRecord(m_txQueue, data)) > 0U)
+				m_modem->writeM17Data(data, len);
+
+			unsigned int ms = stopWatch.elapsed();
+			stopWatch.start();
+
+			m_modem->clock(ms);
+
+			if (m_modem->needsReset()) {
+				m_resetting = true;
+				needReset   = true;
+			} else {
+				while ((len = m_modem->readM17Data(data)) > 0U) {
+					if (!m_rxQueue.hasSpace(len + 1U)) {
+						LogWarning("The modem thread RX queue is full, dropping a frame");
+						continue;
+					}
+
+					if (addRecord(m_rxQueue, data, len))
+						received = true;
+				}
+			}
+
+			m_m17Space = !needReset && m_modem->hasM17Space();
+		}
+
+		if (needReset)
+			reset();
+
+		if (received)
+			m_mainLoop.signal();
+
+		m_loop.wait();
+	}
+}
+
+void CModemThread::reset()
+{
+	// Only this thread touches the modem while m_resetting is set
+	if (m_fd >= 0)
+		m_loop.removeFD(m_fd);
+
+	m_modem->reset();
+
+	// The reopened port has a new descriptor to wait on
+	m_fd = m_modem->getPortFD();
+	if (m_fd >= 0)
+		m_loop.addFD(m_fd);
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_resetting = false;
+	m_m17Space  = m_modem->hasM17Space();
+}
+
+bool CModemThread::addRecord(CSPSCRingBuffer<unsigned char>& queue, const unsigned char* data, unsigned int length)
+{
+	assert(data != NULL);
+	assert(length > 0U && length <= MAX_FRAME_LENGTH);
+
+	unsigned char record[MAX_FRAME_LENGTH + 1U];
+	record[0U] = length;
+	::memcpy(record + 1U, data, length);
+
+	return queue.addData(record, length + 1U);
+}
+
+unsigned int CModemThread::getRecord(CSPSCRingBuffer<unsigned char>& queue, unsigned char* data)
+{
+	assert(data != NULL);
+
+	unsigned int size = queue.dataSize();
+	if (size == 0U)
+		return 0U;
+
+	unsigned char len = 0U;
+	if (!queue.peek(&len, 1U))
+		return 0U;
+
+	// Records are added whole, anything shorter means the queue is corrupt
+	if (len == 0U || len > MAX_FRAME_LENGTH || size < (len + 1U)) {
+		LogError("Invalid record in the modem thread queue, length %u with %u queued", len, size);
+		queue.clear();
+		return 0U;
+	}
+
+	queue.skip(1U);
+
+	if (!queue.getData(data, len))
+		return 0U;
+
+	return len;
+}
@@ -0,0 +1,81 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(ModemThread_H)
+#define	ModemThread_H
+
+#include "SPSCRingBuffer.h"
+#include "EventLoop.h"
+#include "Thread.h"
+#include "Modem.h"
+
+#include <atomic>
+#include <mutex>
+
+/*
+ * Runs the modem on its own thread so that the 40ms frame cadence to the
+ * MMDVM does not depend on how long the codec takes. The thread owns the
+ * CModem and its port, received M17 frames are passed to the main thread
+ * through one SPSC queue and frames to transmit come back through another,
+ * each as a length byte followed by the frame, added to the queue in one go
+ * so that the other side never sees half a record. The space in the modem is
+ * published as a flag.
+ *
+ * The rare control calls, such as changing the frequency, take a lock that
+ * the thread holds while it is using the modem. It is not held while the
+ * modem is being reset, which takes seconds, instead the control calls fail.
+ */
+class CModemThread : public CThread {
+public:
+	CModemThread(CModem* modem, CEventLoop& mainLoop);
+	virtual ~CModemThread();
+
+	bool start();
+
+	// These are called from the main thread
+	bool hasM17Space() const;
+
+	bool writeM17Data(const unsigned char* data, unsigned int length);
+
+	unsigned int readM17Data(unsigned char* data);
+
+	bool changeFrequency(unsigned int rxFrequency, int rxOffset, bool rxInvert, unsigned int txFrequency, int txOffset, bool txInvert);
+
+	void stop();
+
+	virtual void entry();
+
+private:
+	CModem*                        m_modem;
+	CEventLoop&                    m_mainLoop;
+	CEventLoop                     m_loop;
+	CSPSCRingBuffer<unsigned char> m_rxQueue;
+	CSPSCRingBuffer<unsigned char> m_txQueue;
+	std::atomic<bool>              m_m17Space;
+	std::atomic<bool>              m_stop;
+	std::mutex                     m_mutex;
+	bool                           m_resetting;
+	int                            m_fd;
+
+	void reset();
+
+	static bool addRecord(CSPSCRingBuffer<unsigned char>& queue, const unsigned char* data, unsigned int length);
+	static unsigned int getRecord(CSPSCRingBuffer<unsigned char>& queue, unsigned char* data);
+};
+
+#endif
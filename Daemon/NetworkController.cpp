@@ -0,0 +1,360 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#include "NetworkController.h"
+#include "UDPSocket.h"
+#include "Log.h"
+
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <netinet/tcp.h>
+
+// Small enough for one datagram to fit in an Ethernet frame
+const unsigned int TX_BUFFER_LENGTH = 1400U;
+
+const unsigned int RX_BUFFER_LENGTH = 2000U;
+
+const int WAIT_TIMEOUT_MS = 1000;
+
+#if !defined(MSG_NOSIGNAL)
+#define	MSG_NOSIGNAL	0
+#endif
+
+CNetworkController::CNetworkController(MODEM_PROTOCOL protocol, const std::string& address, unsigned short port, unsigned short localPort) :
+m_protocol(protocol),
+m_address(address),
+m_port(port),
+m_localPort(localPort),
+m_fd(-1),
+m_txBuffer(NULL),
+m_txLength(0U),
+m_rxBuffer(NULL),
+m_rxLength(0U),
+m_rxPtr(0U)
+{
+	assert(!address.empty());
+	assert(port > 0U);
+
+	m_txBuffer = new unsigned char[TX_BUFFER_LENGTH];
+	m_rxBuffer = new unsigned char[RX_BUFFER_LENGTH];
+}
+
+CNetworkController::~CNetworkController()
+{
+	delete[] m_txBuffer;
+	delete[] m_rxBuffer;
+}
+
+bool CNetworkController::open()
+{
+	assert(m_fd == -1);
+
+	const char* name = m_protocol == MP_TCP ? "TCP" : "UDP";
+
+	struct addrinfo hints;
+	::memset(&hints, 0x00U, sizeof(hints));
+	hints.ai_socktype = m_protocol == MP_TCP ? SOCK_STREAM : SOCK_DGRAM;
+
+	sockaddr_storage addr;
+	unsigned int addrLen;
+	if (CUDPSocket::lookup(m_address, m_port, addr, addrLen, hints) != 0) {
+		LogError("Unable to resolve the modem address %s", m_address.c_str());
+		return false;
+	}
+
+	m_fd = ::socket(addr.ss_family, hints.ai_socktype, 0);
+	if (m_fd < 0) {
+		LogError("Cannot create the %s socket, err=%d", name, errno);
+		return false;
+	}
+
+	if (m_protocol == MP_UDP && m_localPort > 0U) {
+		sockaddr_storage local;
+		::memset(&local, 0x00U, sizeof(sockaddr_storage));
+		local.ss_family = addr.ss_family;
+
+		socklen_t localLen;
+		if (addr.ss_family == AF_INET6) {
+			((sockaddr_in6*)&local)->sin6_port = htons(m_localPort);
+			localLen = sizeof(sockaddr_in6);
+		} else {
+			((sockaddr_in*)&local)->sin_port = htons(m_localPort);
+			localLen = sizeof(sockaddr_in);
+		}
+
+		int reuse = 1;
+		::setsockopt(m_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+		if (::bind(m_fd, (sockaddr*)&local, localLen) < 0) {
+			LogError("Cannot bind the UDP socket to port %u, err=%d", m_localPort, errno);
+			close();
+			return false;
+		}
+	}
+
+	// Non-blocking before the connect, so that an unreachable modem can't stall the caller
+	int flags = ::fcntl(m_fd, F_GETFL, 0);
+	::fcntl(m_fd, F_SETFL, flags | O_NONBLOCK);
+
+	// For UDP this only fixes the peer, so that send() and recv() can be used
+	if (::connect(m_fd, (sockaddr*)&addr, addrLen) < 0) {
+		if (errno != EINPROGRESS) {
+			LogError("Cannot connect to the modem at %s:%u, err=%d", m_address.c_str(), m_port, errno);
+			close();
+			return false;
+		}
+
+		if (!wait(POLLOUT)) {
+			LogError("Timed out connecting to the modem at %s:%u", m_address.c_str(), m_port);
+			close();
+			return false;
+		}
+
+		int err = 0;
+		socklen_t errLen = sizeof(err);
+		if (::getsockopt(m_fd, SOL_SOCKET, SO_ERROR, &err, &errLen) < 0)
+			err = errno;
+
+		if (err != 0) {
+			LogError("Cannot connect to the modem at %s:%u, err=%d", m_address.c_str(), m_port, err);
+			close();
+			return false;
+		}
+	}
+
+	if (m_protocol == MP_TCP) {
+		int noDelay = 1;
+		if (::setsockopt(m_fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay)) < 0)
+			LogWarning("Cannot disable Nagle on the modem connection, err=%d", errno);
+	}
+
+	m_txLength = 0U;
+	m_rxLength = 0U;
+	m_rxPtr    = 0U;
+
+	LogMessage("Opened a %s connection to the modem at %s:%u", name, m_address.c_str(), m_port);
+
+	return true;
+}
+
+int CNetworkController::read(unsigned char* buffer, unsigned int length)
+{
+	assert(buffer != NULL);
+	assert(m_fd != -1);
+
+	if (length == 0U)
+		return 0;
+
+	if (!flush())
+		return -1;
+
+	int n = receive(buffer, length);
+	if (n <= 0)
+		return n;
+
+	unsigned int offset = n;
+
+	// Once something has arrived, wait for the rest of it
+	while (offset < length) {
+		if (m_rxPtr >= m_rxLength && !wait(POLLIN)) {
+			LogError("Timed out reading from the modem");
+			return -1;
+		}
+
+		n = receive(buffer + offset, length - offset);
+		if (n < 0)
+			return n;
+
+		offset += n;
+	}
+
+	return length;
+}
+
+int CNetworkController::readAvailable(unsigned char* buffer, unsigned int length)
+{
+	assert(buffer != NULL);
+	assert(m_fd != -1);
+
+	if (length == 0U)
+		return 0;
+
+	if (!flush())
+		return -1;
+
+	return receive(buffer, length);
+}
+
+int CNetworkController::write(const unsigned char* buffer, unsigned int length)
+{
+	assert(buffer != NULL);
+	assert(m_fd != -1);
+
+	if (length == 0U)
+		return 0;
+
+	if ((m_txLength + length) > TX_BUFFER_LENGTH) {
+		if (!flush())
+			return -1;
+	}
+
+	if (length > TX_BUFFER_LENGTH)
+		return send(buffer, length) ? int(length) : -1;
+
+	::memcpy(m_txBuffer + m_txLength, buffer, length);
+	m_txLength += length;
+
+	return length;
+}
+
+bool CNetworkController::flush()
+{
+	assert(m_fd != -1);
+
+	if (m_txLength == 0U)
+		return true;
+
+	bool ret = send(m_txBuffer, m_txLength);
+
+	m_txLength = 0U;
+
+	return ret;
+}
+
+void CNetworkController::close()
+{
+	assert(m_fd != -1);
+
+	::close(m_fd);
+	m_fd = -1;
+}
+
+int CNetworkController::getFD() const
+{
+	return m_fd;
+}
+
+int CNetworkController::receive(unsigned char* buffer, unsigned int length)
+{
+	assert(buffer != NULL);
+
+	if (m_protocol == MP_TCP) {
+		ssize_t n = ::recv(m_fd, buffer, length, 0);
+		if (n < 0) {
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+				return 0;
+
+			LogError("Error from recv(), errno=%d", errno);
+			return -1;
+		}
+
+		if (n == 0) {
+			LogError("The modem has closed the connection");
+			return -1;
+		}
+
+		return int(n);
+	}
+
+	// A datagram has to be read whole, so keep what the caller could not take
+	if (m_rxPtr >= m_rxLength) {
+		ssize_t n = ::recv(m_fd, m_rxBuffer, RX_BUFFER_LENGTH, 0);
+		if (n < 0) {
+			// Refused means nothing is listening at the far end yet
+			if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ECONNREFUSED)
+				return 0;
+
+			LogError("Error from recv(), errno=%d", errno);
+			return -1;
+		}
+
+		m_rxLength = (unsigned int)n;
+		m_rxPtr    = 0U;
+	}
+
+	unsigned int n = m_rxLength - m_rxPtr;
+	if (n > length)
+		n = length;
+
+	::memcpy(buffer, m_rxBuffer + m_rxPtr, n);
+	m_rxPtr += n;
+
+	return int(n);
+}
+
+bool CNetworkController::send(const unsigned char* buffer, unsigned int length)
+{
+	assert(buffer != NULL);
+
+	if (m_protocol == MP_UDP) {
+		ssize_t n = ::send(m_fd, buffer, length, 0);
+		if (n < 0) {
+			// Like a serial line, anything sent with no one listening is lost
+			if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ECONNREFUSED)
+				return true;
+
+			LogError("Error from send(), errno=%d", errno);
+			return false;
+		}
+
+		return true;
+	}
+
+	unsigned int ptr = 0U;
+	while (ptr < length) {
+		ssize_t n = ::send(m_fd, buffer + ptr, length - ptr, MSG_NOSIGNAL);
+		if (n < 0) {
+			if (errno != EAGAIN && errno != EWOULDBLOCK) {
+				LogError("Error from send(), errno=%d", errno);
+				return false;
+			}
+
+			if (!wait(POLLOUT)) {
+				LogError("Timed out writing to the modem");
+				return false;
+			}
+
+			continue;
+		}
+
+		ptr += n;
+	}
+
+	return true;
+}
+
+bool CNetworkController::wait(short events)
+{
+	struct pollfd pfd;
+	pfd.fd      = m_fd;
+	pfd.events  = events;
+	pfd.revents = 0;
+
+	int n = ::poll(&pfd, 1, WAIT_TIMEOUT_MS);
+	if (n < 0 && errno != EINTR) {
+		LogError("Error returned from poll, err=%d", errno);
+		return false;
+	}
+
+	return n != 0;
+}
@@ -0,0 +1,74 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#ifndef NetworkController_H
+#define NetworkController_H
+
+#include "ModemPort.h"
+
+#include <string>
+
+enum MODEM_PROTOCOL {
+	MP_TCP,
+	MP_UDP
+};
+
+/*
+ * Carries the raw MMDVM serial protocol over the network to a modem on a
+ * remote site, either as a TCP stream or as UDP datagrams. Nagle is disabled
+ * on TCP, instead the frames written during one modem clock are gathered up
+ * and sent together when the modem is flushed, or before the next read.
+ */
+class CNetworkController : public IModemPort {
+public:
+	CNetworkController(MODEM_PROTOCOL protocol, const std::string& address, unsigned short port, unsigned short localPort = 0U);
+	virtual ~CNetworkController();
+
+	virtual bool open();
+
+	virtual int read(unsigned char* buffer, unsigned int length);
+
+	virtual int readAvailable(unsigned char* buffer, unsigned int length);
+
+	virtual int write(const unsigned char* buffer, unsigned int length);
+
+	virtual bool flush();
+
+	virtual void close();
+
+	virtual int getFD() const;
+
+private:
+	MODEM_PROTOCOL m_protocol;
+	std::string    m_address;
+	unsigned short m_port;
+	unsigned short m_localPort;
+	int            m_fd;
+	unsigned char* m_txBuffer;
+	unsigned int   m_txLength;
+	unsigned char* m_rxBuffer;
+	unsigned int   m_rxLength;
+	unsigned int   m_rxPtr;
+
+	int  receive(unsigned char* buffer, unsigned int length);
+	bool send(const unsigned char* buffer, unsigned int length);
+	bool wait(short events);
+};
+
+#endif
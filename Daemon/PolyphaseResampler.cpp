@@ -0,0 +1,229 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#include "PolyphaseResampler.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// Taps in each branch of the interpolator, the decimator uses the whole filter. It must be
+// a multiple of 16 for the dot product.
+const unsigned int TAPS_PER_PHASE = 48U;
+
+// The -6 dB point, the passband reaches about 3.4 kHz and the stopband starts at 4 kHz
+const double CUTOFF_HZ = 3700.0;
+
+// About 63 dB of stopband attenuation
+const double KAISER_BETA = 6.0;
+
+static double besselI0(double x)
+{
+	double sum  = 1.0;
+	double term = 1.0;
+
+	for (unsigned int k = 1U; k < 50U; k++) {
+		term *= (x / (2.0 * k)) * (x / (2.0 * k));
+		sum  += term;
+		if (term < (sum * 1.0E-12))
+			break;
+	}
+
+	return sum;
+}
+
+// The length is always a multiple of 16, four accumulators keep the adds from waiting on each other
+static inline float dot(const float* a, const float* b, unsigned int n)
+{
+#if defined(__SSE2__)
+	__m128 sum0 = _mm_setzero_ps();
+	__m128 sum1 = _mm_setzero_ps();
+	__m128 sum2 = _mm_setzero_ps();
+	__m128 sum3 = _mm_setzero_ps();
+	for (unsigned int i = 0U; i < n; i += 16U) {
+		sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(a + i + 0U),  _mm_loadu_ps(b + i + 0U)));
+		sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(a + i + 4U),  _mm_loadu_ps(b + i + 4U)));
+		sum2 = _mm_add_ps(sum2, _mm_mul_ps(_mm_loadu_ps(a + i + 8U),  _mm_loadu_ps(b + i + 8U)));
+		sum3 = _mm_add_ps(sum3, _mm_mul_ps(_mm_loadu_ps(a + i + 12U), _mm_loadu_ps(b + i + 12U)));
+	}
+
+	__m128 sum = _mm_add_ps(_mm_add_ps(sum0, sum1), _mm_add_ps(sum2, sum3));
+	sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+	sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 0x55));
+
+	return _mm_cvtss_f32(sum);
+#elif defined(__ARM_NEON)
+	float32x4_t sum0 = vdupq_n_f32(0.0F);
+	float32x4_t sum1 = vdupq_n_f32(0.0F);
+	float32x4_t sum2 = vdupq_n_f32(0.0F);
+	float32x4_t sum3 = vdupq_n_f32(0.0F);
+	for (unsigned int i = 0U; i < n; i += 16U) {
+		sum0 = vmlaq_f32(sum0, vld1q_f32(a + i + 0U),  vld1q_f32(b + i + 0U));
+		sum1 = vmlaq_f32(sum1, vld1q_f32(a + i + 4U),  vld1q_f32(b + i + 4U));
+		sum2 = vmlaq_f32(sum2, vld1q_f32(a + i + 8U),  vld1q_f32(b + i + 8U));
+		sum3 = vmlaq_f32(sum3, vld1q_f32(a + i + 12U), vld1q_f32(b + i + 12U));
+	}
+
+	float32x4_t sum = vaddq_f32(vaddq_f32(sum0, sum1), vaddq_f32(sum2, sum3));
+
+#if defined(__aarch64__)
+	return vaddvq_f32(sum);
+#else
+	float32x2_t half = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+	return vget_lane_f32(vpadd_f32(half, half), 0);
+#endif
+#else
+	float sum0 = 0.0F, sum1 = 0.0F, sum2 = 0.0F, sum3 = 0.0F;
+	for (unsigned int i = 0U; i < n; i += 4U) {
+		sum0 += a[i + 0U] * b[i + 0U];
+		sum1 += a[i + 1U] * b[i + 1U];
+		sum2 += a[i + 2U] * b[i + 2U];
+		sum3 += a[i + 3U] * b[i + 3U];
+	}
+
+	return (sum0 + sum1) + (sum2 + sum3);
+#endif
+}
+
+CPolyphaseResampler::CPolyphaseResampler(unsigned int inRate, unsigned int outRate) :
+m_factor(0U),
+m_interpolate(outRate > inRate),
+m_taps(0U),
+m_coeffs(NULL),
+m_history(0U),
+m_buffer()
+{
+	assert(inRate > 0U);
+	assert(outRate > 0U);
+
+	unsigned int highRate = m_interpolate ? outRate : inRate;
+	unsigned int lowRate  = m_interpolate ? inRate  : outRate;
+	assert((highRate % lowRate) == 0U);
+
+	m_factor = highRate / lowRate;
+
+	unsigned int length = m_factor * TAPS_PER_PHASE;
+
+	// The prototype filter at the higher rate, with unity gain at DC
+	std::vector<double> filter(length);
+	double fc     = CUTOFF_HZ / double(highRate);
+	double centre = double(length - 1U) / 2.0;
+	double sum    = 0.0;
+	for (unsigned int i = 0U; i < length; i++) {
+		double t = double(i) - centre;
+		double x = 2.0 * fc * t;
+		double sinc = (t == 0.0) ? 1.0 : ::sin(M_PI * x) / (M_PI * x);
+
+		double r = t / centre;
+		double window = besselI0(KAISER_BETA * ::sqrt(1.0 - r * r)) / besselI0(KAISER_BETA);
+
+		filter[i] = 2.0 * fc * sinc * window;
+		sum += filter[i];
+	}
+
+	m_coeffs = new float[length];
+
+	if (m_interpolate) {
+		// Each branch sees one input sample in every factor, its gain makes up for the missing ones.
+		// The branches are reversed so that they line up with the input in time order.
+		m_taps    = TAPS_PER_PHASE;
+		m_history = TAPS_PER_PHASE - 1U;
+
+		for (unsigned int p = 0U; p < m_factor; p++) {
+			for (unsigned int k = 0U; k < TAPS_PER_PHASE; k++)
+				m_coeffs[p * TAPS_PER_PHASE + (TAPS_PER_PHASE - 1U - k)] = float(double(m_factor) * filter[k * m_factor + p] / sum);
+		}
+	} else {
+		m_taps    = length;
+		m_history = length - 1U;
+
+		for (unsigned int i = 0U; i < length; i++)
+			m_coeffs[length - 1U - i] = float(filter[i] / sum);
+	}
+
+	m_buffer.resize(m_history, 0.0F);
+}
+
+CPolyphaseResampler::~CPolyphaseResampler()
+{
+	delete[] m_coeffs;
+}
+
+bool CPolyphaseResampler::process(const float* in, unsigned int inLen, float* out, unsigned int outLen)
+{
+	assert(in != NULL);
+	assert(out != NULL);
+
+	if ((m_interpolate && outLen != (inLen * m_factor)) || (!m_interpolate && (inLen != (outLen * m_factor)))) {
+		LogError("The resampler was given %u samples for %u", inLen, outLen);
+		return false;
+	}
+
+	// The history is followed by the new block, only grows on the first call
+	if (m_buffer.size() < (m_history + inLen))
+		m_buffer.resize(m_history + inLen);
+
+	::memcpy(m_buffer.data() + m_history, in, inLen * sizeof(float));
+
+	if (m_interpolate)
+		interpolate(inLen, out);
+	else
+		decimate(outLen, out);
+
+	::memmove(m_buffer.data(), m_buffer.data() + inLen, m_history * sizeof(float));
+
+	return true;
+}
+
+void CPolyphaseResampler::interpolate(unsigned int inLen, float* out) const
+{
+	const float* buffer = m_buffer.data();
+
+	for (unsigned int n = 0U; n < inLen; n++) {
+		for (unsigned int p = 0U; p < m_factor; p++)
+			*out++ = dot(buffer + n, m_coeffs + p * m_taps, m_taps);
+	}
+}
+
+void CPolyphaseResampler::decimate(unsigned int outLen, float* out) const
+{
+	const float* buffer = m_buffer.data();
+
+	// Each output lines up with the last of the input samples that it replaces
+	for (unsigned int m = 0U; m < outLen; m++)
+		out[m] = dot(buffer + m * m_factor + m_factor - 1U, m_coeffs, m_taps);
+}
+
+void CPolyphaseResampler::reset()
+{
+	std::fill(m_buffer.begin(), m_buffer.end(), 0.0F);
+}
+
+const char* CPolyphaseResampler::getName() const
+{
+	return "polyphase";
+}
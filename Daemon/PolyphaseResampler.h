@@ -0,0 +1,57 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#ifndef PolyphaseResampler_H
+#define PolyphaseResampler_H
+
+#include "Resampler.h"
+
+#include <vector>
+
+/*
+ * A polyphase FIR interpolator or decimator for rates that are a whole
+ * multiple of each other, such as 8 kHz and 48 kHz. The low pass filter is a
+ * Kaiser windowed sinc designed at the higher rate, the interpolator runs one
+ * short branch of it per output phase and the decimator only works out the
+ * outputs that it keeps. The dot products use SSE2 or NEON where available.
+ */
+class CPolyphaseResampler : public IResampler {
+public:
+	CPolyphaseResampler(unsigned int inRate, unsigned int outRate);
+	virtual ~CPolyphaseResampler();
+
+	virtual bool process(const float* in, unsigned int inLen, float* out, unsigned int outLen);
+
+	virtual void reset();
+
+	virtual const char* getName() const;
+
+private:
+	unsigned int       m_factor;
+	bool               m_interpolate;
+	unsigned int       m_taps;
+	float*             m_coeffs;
+	unsigned int       m_history;
+	std::vector<float> m_buffer;
+
+	void interpolate(unsigned int inLen, float* out) const;
+	void decimate(unsigned int outLen, float* out) const;
+};
+
+#endif
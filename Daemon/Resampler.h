@@ -0,0 +1,47 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#ifndef Resampler_H
+#define Resampler_H
+
+enum RESAMPLER_TYPE {
+	RT_SRC,
+	RT_POLYPHASE
+};
+
+/*
+ * Converts fixed size blocks of audio between two sample rates, the ratio is
+ * set when the resampler is created and the filter state is carried over from
+ * one block to the next.
+ */
+class IResampler {
+public:
+	virtual ~IResampler() = 0;
+
+	// The output must be exactly the input length scaled by the ratio
+	virtual bool process(const float* in, unsigned int inLen, float* out, unsigned int outLen) = 0;
+
+	virtual void reset() = 0;
+
+	virtual const char* getName() const = 0;
+
+private:
+};
+
+#endif
@@ -0,0 +1,227 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef SPSCRingBuffer_H
+#define SPSCRingBuffer_H
+
+#include "Log.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cassert>
+#include <cstring>
+#include <type_traits>
+
+const unsigned int SPSC_CACHE_LINE_SIZE = 64U;
+
+/*
+ * A lock-free ring buffer for exactly one producer thread and one consumer
+ * thread. The read and write indices are free running and live on their own
+ * cache lines, the producer publishes data with a release store and the
+ * consumer frees space with a release store, so neither side ever sees a torn
+ * size. The storage is rounded up to a power of two.
+ *
+ * addData() and freeSpace()/hasSpace() belong to the producer, everything
+ * else, including clear(), belongs to the consumer.
+ */
+template<class T> class CSPSCRingBuffer {
+	static_assert(std::is_trivially_copyable<T>::value, "CSPSCRingBuffer needs a trivially copyable type");
+
+public:
+	CSPSCRingBuffer(unsigned int length, const char* name) :
+	m_iPtr(0U),
+	m_oPtrCache(0U),
+	m_oPtr(0U),
+	m_iPtrCache(0U),
+	m_length(1U),
+	m_mask(0U),
+	m_name(name),
+	m_buffer(NULL)
+	{
+		assert(length > 0U);
+		assert(name != NULL);
+
+		while (m_length < length)
+			m_length <<= 1;
+
+		m_mask = m_length - 1U;
+
+		m_buffer = new T[m_length];
+
+		::memset(m_buffer, 0x00, m_length * sizeof(T));
+	}
+
+	~CSPSCRingBuffer()
+	{
+		delete[] m_buffer;
+	}
+
+	bool addData(const T* buffer, unsigned int nSamples)
+	{
+		assert(buffer != NULL);
+
+		unsigned int iPtr = m_iPtr.load(std::memory_order_relaxed);
+
+		if (nSamples > (m_length - (iPtr - m_oPtrCache))) {
+			m_oPtrCache = m_oPtr.load(std::memory_order_acquire);
+
+			unsigned int space = m_length - (iPtr - m_oPtrCache);
+			if (nSamples > space) {
+				LogError("%s buffer overflow, dropping %u samples, %u free", m_name, nSamples, space);
+				return false;
+			}
+		}
+
+		unsigned int index = iPtr & m_mask;
+		unsigned int len1  = m_length - index;
+
+		if (nSamples <= len1) {
+			::memcpy(m_buffer + index, buffer, nSamples * sizeof(T));
+		} else {
+			::memcpy(m_buffer + index, buffer, len1 * sizeof(T));
+			::memcpy(m_buffer, buffer + len1, (nSamples - len1) * sizeof(T));
+		}
+
+		m_iPtr.store(iPtr + nSamples, std::memory_order_release);
+
+		return true;
+	}
+
+	bool getData(T* buffer, unsigned int nSamples)
+	{
+		assert(buffer != NULL);
+
+		if (!peek(buffer, nSamples))
+			return false;
+
+		skip(nSamples);
+
+		return true;
+	}
+
+	bool peek(T* buffer, unsigned int nSamples)
+	{
+		assert(buffer != NULL);
+
+		const T* data1 = NULL;
+		const T* data2 = NULL;
+		unsigned int len1 = 0U;
+		unsigned int len2 = 0U;
+		unsigned int size = peek(data1, len1, data2, len2);
+
+		if (size < nSamples) {
+			LogError("**** Underflow in %s ring buffer, %u < %u", m_name, size, nSamples);
+			return false;
+		}
+
+		if (nSamples <= len1) {
+			::memcpy(buffer, data1, nSamples * sizeof(T));
+		} else {
+			::memcpy(buffer, data1, len1 * sizeof(T));
+			::memcpy(buffer + len1, data2, (nSamples - len1) * sizeof(T));
+		}
+
+		return true;
+	}
+
+	// Zero-copy access to the readable data as at most two contiguous spans,
+	// the data stays valid until it is released with skip()
+	unsigned int peek(const T*& data1, unsigned int& len1, const T*& data2, unsigned int& len2)
+	{
+		unsigned int oPtr = m_oPtr.load(std::memory_order_relaxed);
+
+		m_iPtrCache = m_iPtr.load(std::memory_order_acquire);
+
+		unsigned int size  = m_iPtrCache - oPtr;
+		unsigned int index = oPtr & m_mask;
+
+		data1 = m_buffer + index;
+		data2 = m_buffer;
+
+		len1 = m_length - index;
+		if (len1 >= size) {
+			len1 = size;
+			len2 = 0U;
+		} else {
+			len2 = size - len1;
+		}
+
+		return size;
+	}
+
+	void skip(unsigned int nSamples)
+	{
+		unsigned int oPtr = m_oPtr.load(std::memory_order_relaxed);
+
+		assert(nSamples <= (m_iPtrCache - oPtr));
+
+		m_oPtr.store(oPtr + nSamples, std::memory_order_release);
+	}
+
+	void clear()
+	{
+		m_iPtrCache = m_iPtr.load(std::memory_order_acquire);
+
+		m_oPtr.store(m_iPtrCache, std::memory_order_release);
+	}
+
+	unsigned int freeSpace() const
+	{
+		return m_length - dataSize();
+	}
+
+	unsigned int dataSize() const
+	{
+		unsigned int oPtr = m_oPtr.load(std::memory_order_acquire);
+		unsigned int iPtr = m_iPtr.load(std::memory_order_acquire);
+
+		return iPtr - oPtr;
+	}
+
+	bool hasSpace(unsigned int length) const
+	{
+		return freeSpace() > length;
+	}
+
+	bool hasData() const
+	{
+		return dataSize() > 0U;
+	}
+
+	bool isEmpty() const
+	{
+		return dataSize() == 0U;
+	}
+
+private:
+	// Producer owned
+	alignas(SPSC_CACHE_LINE_SIZE) std::atomic<unsigned int> m_iPtr;
+	unsigned int m_oPtrCache;
+
+	// Consumer owned
+	alignas(SPSC_CACHE_LINE_SIZE) std::atomic<unsigned int> m_oPtr;
+	unsigned int m_iPtrCache;
+
+	// Read only after construction
+	alignas(SPSC_CACHE_LINE_SIZE) unsigned int m_length;
+	unsigned int m_mask;
+	const char*  m_name;
+	T*           m_buffer;
+};
+
+#endif
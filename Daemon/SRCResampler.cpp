@@ -0,0 +1,76 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#include "SRCResampler.h"
+#include "Log.h"
+
+#include <cassert>
+#include <cstring>
+
+CSRCResampler::CSRCResampler(unsigned int inRate, unsigned int outRate) :
+m_ratio(double(outRate) / double(inRate)),
+m_state(NULL),
+m_error(0)
+{
+	assert(inRate > 0U);
+	assert(outRate > 0U);
+
+	m_state = ::src_new(SRC_SINC_FASTEST, 1, &m_error);
+}
+
+CSRCResampler::~CSRCResampler()
+{
+	::src_delete(m_state);
+}
+
+bool CSRCResampler::process(const float* in, unsigned int inLen, float* out, unsigned int outLen)
+{
+	assert(in != NULL);
+	assert(out != NULL);
+
+	SRC_DATA data;
+	data.data_in       = in;
+	data.data_out      = out;
+	data.input_frames  = inLen;
+	data.output_frames = outLen;
+	data.end_of_input  = 0;
+	data.src_ratio     = m_ratio;
+
+	int ret = ::src_process(m_state, &data);
+	if (ret != 0) {
+		LogError("Error from the resampler - %d - %s", ret, ::src_strerror(ret));
+		return false;
+	}
+
+	// Only the first blocks come up short, while the filter fills
+	if (data.output_frames_gen < long(outLen))
+		::memset(out + data.output_frames_gen, 0x00U, (outLen - data.output_frames_gen) * sizeof(float));
+
+	return true;
+}
+
+void CSRCResampler::reset()
+{
+	::src_reset(m_state);
+}
+
+const char* CSRCResampler::getName() const
+{
+	return "src";
+}
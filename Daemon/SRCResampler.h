@@ -0,0 +1,45 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#ifndef SRCResampler_H
+#define SRCResampler_H
+
+#include "Resampler.h"
+
+#include <samplerate.h>
+
+// The general purpose libsamplerate converter, using its fastest sinc filter
+class CSRCResampler : public IResampler {
+public:
+	CSRCResampler(unsigned int inRate, unsigned int outRate);
+	virtual ~CSRCResampler();
+
+	virtual bool process(const float* in, unsigned int inLen, float* out, unsigned int outLen);
+
+	virtual void reset();
+
+	virtual const char* getName() const;
+
+private:
+	double     m_ratio;
+	SRC_STATE* m_state;
+	int        m_error;
+};
+
+#endif
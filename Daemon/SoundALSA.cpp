@@ -27,6 +27,9 @@ m_readDevice(readDevice),
 m_writeDevice(writeDevice),
 m_sampleRate(sampleRate),
 m_blockSize(blockSize),
+m_mmap(false),
+m_periodTime(0U),
+m_bufferTime(0U),
 m_callback(NULL),
 m_id(-1),
 m_reader(NULL),
@@ -40,6 +43,13 @@ CSoundALSA::~CSoundALSA()
 {
 }
 
+void CSoundALSA::setBuffering(bool mmap, unsigned int periodTime, unsigned int bufferTime)
+{
+	m_mmap       = mmap;
+	m_periodTime = periodTime;
+	m_bufferTime = bufferTime;
+}
+
 void CSoundALSA::setCallback(IAudioCallback* callback, int id)
 {
 	assert(callback != NULL);
@@ -70,10 +80,9 @@ bool CSoundALSA::open()
 		return false;
 	}
 
-	if ((err = ::snd_pcm_hw_params_set_access(playHandle, hw_params, SND_PCM_ACCESS_RW_INTERLEAVED)) < 0) {
-		LogError("Cannot set access type (%s)", ::snd_strerror(err));
+	bool playMMap = m_mmap;
+	if (!setAccess(playHandle, hw_params, playMMap))
 		return false;
-	}
 
 	if ((err = ::snd_pcm_hw_params_set_format(playHandle, hw_params, SND_PCM_FORMAT_FLOAT)) < 0) {
 		LogError("Cannot set sample format (%s)", ::snd_strerror(err));
@@ -81,7 +90,10 @@ bool CSoundALSA::open()
 	}
 
 	if ((err = ::snd_pcm_hw_params_set_rate(playHandle, hw_params, m_sampleRate, 0)) < 0) {
-		LogError("Cannot set sample rate (%s)", ::snd_strerror(err));
+		unsigned int minRate = 0U, maxRate = 0U;
+		::snd_pcm_hw_params_get_rate_min(hw_params, &minRate, NULL);
+		::snd_pcm_hw_params_get_rate_max(hw_params, &maxRate, NULL);
+		LogError("Cannot set sample rate %u, the device supports %u to %u (%s)", m_sampleRate, minRate, maxRate, ::snd_strerror(err));
 		return false;
 	}
 
@@ -96,6 +108,8 @@ bool CSoundALSA::open()
 		}
 	}
 
+	setBuffering(playHandle, hw_params);
+
 	if ((err = ::snd_pcm_hw_params(playHandle, hw_params)) < 0) {
 		LogError("Cannot set parameters (%s)", ::snd_strerror(err));
 		return false;
@@ -103,6 +117,9 @@ bool CSoundALSA::open()
 
 	::snd_pcm_hw_params_free(hw_params);
 
+	if (!setSoftware(playHandle, playMMap))
+		return false;
+
 	if ((err = ::snd_pcm_prepare(playHandle)) < 0) {
 		LogError("Cannot prepare audio interface for use (%s)", ::snd_strerror(err));
 		return false;
@@ -125,10 +142,9 @@ bool CSoundALSA::open()
 		return false;
 	}
 
-	if ((err = ::snd_pcm_hw_params_set_access(recHandle, hw_params, SND_PCM_ACCESS_RW_INTERLEAVED)) < 0) {
-		LogError("Cannot set access type (%s)", ::snd_strerror(err));
+	bool recMMap = m_mmap;
+	if (!setAccess(recHandle, hw_params, recMMap))
 		return false;
-	}
 
 	if ((err = ::snd_pcm_hw_params_set_format(recHandle, hw_params, SND_PCM_FORMAT_FLOAT)) < 0) {
 		LogError("Cannot set sample format (%s)", ::snd_strerror(err));
@@ -136,7 +152,10 @@ bool CSoundALSA::open()
 	}
 
 	if ((err = ::snd_pcm_hw_params_set_rate(recHandle, hw_params, m_sampleRate, 0)) < 0) {
-		LogError("Cannot set sample rate (%s)", ::snd_strerror(err));
+		unsigned int minRate = 0U, maxRate = 0U;
+		::snd_pcm_hw_params_get_rate_min(hw_params, &minRate, NULL);
+		::snd_pcm_hw_params_get_rate_max(hw_params, &maxRate, NULL);
+		LogError("Cannot set sample rate %u, the device supports %u to %u (%s)", m_sampleRate, minRate, maxRate, ::snd_strerror(err));
 		return false;
 	}
 
@@ -151,6 +170,8 @@ bool CSoundALSA::open()
 		}
 	}
 
+	setBuffering(recHandle, hw_params);
+
 	if ((err = ::snd_pcm_hw_params(recHandle, hw_params)) < 0) {
 		LogError("Cannot set parameters (%s)", ::snd_strerror(err));
 		return false;
@@ -158,19 +179,24 @@ bool CSoundALSA::open()
 
 	::snd_pcm_hw_params_free(hw_params);
 
+	if (!setSoftware(recHandle, recMMap))
+		return false;
+
 	if ((err = ::snd_pcm_prepare(recHandle)) < 0) {
 		LogError("Cannot prepare audio interface for use (%s)", ::snd_strerror(err));
 		return false;
 	}
 
-	short samples[256];
-	for (unsigned int i = 0U; i < 10U; ++i)
-		::snd_pcm_readi(recHandle, samples, 128);
+	if (!recMMap) {
+		short samples[256];
+		for (unsigned int i = 0U; i < 10U; ++i)
+			::snd_pcm_readi(recHandle, samples, 128);
+	}
 
-	LogMessage("Opened %s:%s Rate %u", m_writeDevice.c_str(), m_readDevice.c_str(), m_sampleRate);
+	LogMessage("Opened %s:%s Rate %u%s", m_writeDevice.c_str(), m_readDevice.c_str(), m_sampleRate, (playMMap && recMMap) ? " using mmap" : "");
 
-	m_reader = new CSoundALSAReader(recHandle,  m_blockSize, recChannels,  m_callback, m_id);
-	m_writer = new CSoundALSAWriter(playHandle, m_blockSize, playChannels, m_callback, m_id);
+	m_reader = new CSoundALSAReader(recHandle,  m_blockSize, recChannels,  recMMap,  m_callback, m_id);
+	m_writer = new CSoundALSAWriter(playHandle, m_blockSize, playChannels, playMMap, m_callback, m_id);
 
 	m_reader->run();
 	m_writer->run();
@@ -192,11 +218,92 @@ bool CSoundALSA::isWriterBusy() const
 	return m_writer->isBusy();
 }
 
-CSoundALSAReader::CSoundALSAReader(snd_pcm_t* handle, unsigned int blockSize, unsigned int channels, IAudioCallback* callback, int id) :
+bool CSoundALSA::setAccess(snd_pcm_t* handle, snd_pcm_hw_params_t* params, bool& mmap)
+{
+	assert(handle != NULL);
+	assert(params != NULL);
+
+	int err;
+	if (mmap) {
+		if ((err = ::snd_pcm_hw_params_set_access(handle, params, SND_PCM_ACCESS_MMAP_INTERLEAVED)) == 0)
+			return true;
+
+		LogWarning("Cannot use mmap access (%s), falling back to read/write", ::snd_strerror(err));
+		mmap = false;
+	}
+
+	if ((err = ::snd_pcm_hw_params_set_access(handle, params, SND_PCM_ACCESS_RW_INTERLEAVED)) < 0) {
+		LogError("Cannot set access type (%s)", ::snd_strerror(err));
+		return false;
+	}
+
+	return true;
+}
+
+void CSoundALSA::setBuffering(snd_pcm_t* handle, snd_pcm_hw_params_t* params)
+{
+	assert(handle != NULL);
+	assert(params != NULL);
+
+	int err;
+	if (m_periodTime > 0U) {
+		snd_pcm_uframes_t frames = (m_sampleRate * m_periodTime) / 1000U;
+		if ((err = ::snd_pcm_hw_params_set_period_size_near(handle, params, &frames, NULL)) < 0)
+			LogWarning("Cannot set the period size (%s)", ::snd_strerror(err));
+	}
+
+	if (m_bufferTime > 0U) {
+		snd_pcm_uframes_t frames = (m_sampleRate * m_bufferTime) / 1000U;
+		if ((err = ::snd_pcm_hw_params_set_buffer_size_near(handle, params, &frames)) < 0)
+			LogWarning("Cannot set the buffer size (%s)", ::snd_strerror(err));
+	}
+}
+
+bool CSoundALSA::setSoftware(snd_pcm_t* handle, bool mmap)
+{
+	assert(handle != NULL);
+
+	// Nothing waits on the device with read/write access, it blocks in the calls instead
+	if (!mmap)
+		return true;
+
+	snd_pcm_sw_params_t* sw_params;
+	int err;
+	if ((err = ::snd_pcm_sw_params_malloc(&sw_params)) < 0) {
+		LogError("Cannot allocate software parameter structure (%s)", ::snd_strerror(err));
+		return false;
+	}
+
+	if ((err = ::snd_pcm_sw_params_current(handle, sw_params)) < 0) {
+		LogError("Cannot initialize software parameter structure (%s)", ::snd_strerror(err));
+		::snd_pcm_sw_params_free(sw_params);
+		return false;
+	}
+
+	// Wake the thread once there is room for, or data for, a whole block
+	if ((err = ::snd_pcm_sw_params_set_avail_min(handle, sw_params, m_blockSize)) < 0) {
+		LogError("Cannot set the minimum available count (%s)", ::snd_strerror(err));
+		::snd_pcm_sw_params_free(sw_params);
+		return false;
+	}
+
+	if ((err = ::snd_pcm_sw_params(handle, sw_params)) < 0) {
+		LogError("Cannot set software parameters (%s)", ::snd_strerror(err));
+		::snd_pcm_sw_params_free(sw_params);
+		return false;
+	}
+
+	::snd_pcm_sw_params_free(sw_params);
+
+	return true;
+}
+
+CSoundALSAReader::CSoundALSAReader(snd_pcm_t* handle, unsigned int blockSize, unsigned int channels, bool mmap, IAudioCallback* callback, int id) :
 CThread(),
 m_handle(handle),
 m_blockSize(blockSize),
 m_channels(channels),
+m_mmap(mmap),
 m_callback(callback),
 m_id(id),
 m_killed(false),
@@ -219,7 +326,16 @@ void CSoundALSAReader::entry()
 {
 	LogMessage("Starting ALSA reader thread");
 
+	// Capture with mmap access has to be started by hand
+	if (m_mmap)
+		::snd_pcm_start(m_handle);
+
 	while (!m_killed) {
+		if (m_mmap) {
+			readMMap();
+			continue;
+		}
+
 		snd_pcm_sframes_t ret;
 		while ((ret = ::snd_pcm_readi(m_handle, m_samples, m_blockSize)) < 0) {
 			if (ret != -EPIPE)
@@ -239,16 +355,67 @@ void CSoundALSAReader::entry()
 	::snd_pcm_close(m_handle);
 }
 
+void CSoundALSAReader::readMMap()
+{
+	snd_pcm_sframes_t avail = ::snd_pcm_avail_update(m_handle);
+	if (avail < 0) {
+		if (avail != -EPIPE)
+			LogWarning("snd_pcm_avail_update returned %d (%s)", avail, ::snd_strerror(avail));
+
+		::snd_pcm_recover(m_handle, avail, 1);
+		::snd_pcm_start(m_handle);
+		return;
+	}
+
+	if (avail < snd_pcm_sframes_t(m_blockSize)) {
+		int ret = ::snd_pcm_wait(m_handle, 100);
+		if (ret < 0) {
+			::snd_pcm_recover(m_handle, ret, 1);
+			::snd_pcm_start(m_handle);
+		}
+		return;
+	}
+
+	const snd_pcm_channel_area_t* areas;
+	snd_pcm_uframes_t offset;
+	snd_pcm_uframes_t frames = m_blockSize;
+	int err = ::snd_pcm_mmap_begin(m_handle, &areas, &offset, &frames);
+	if (err < 0) {
+		LogWarning("snd_pcm_mmap_begin returned %d (%s)", err, ::snd_strerror(err));
+		::snd_pcm_recover(m_handle, err, 1);
+		::snd_pcm_start(m_handle);
+		return;
+	}
+
+	// The first channel, in the DMA buffer itself, is passed on as it is when it is the only one
+	const float* samples = (const float*)areas[0U].addr + areas[0U].first / 32U + offset * (areas[0U].step / 32U);
+	if (m_channels > 1U) {
+		for (unsigned int i = 0U; i < frames; i++)
+			m_samples[i] = samples[i * m_channels];
+		samples = m_samples;
+	}
+
+	if (frames > 0U)
+		m_callback->readCallback(samples, (unsigned int)frames, m_id);
+
+	snd_pcm_sframes_t ret = ::snd_pcm_mmap_commit(m_handle, offset, frames);
+	if (ret < 0 || snd_pcm_uframes_t(ret) != frames) {
+		::snd_pcm_recover(m_handle, ret >= 0 ? -EPIPE : ret, 1);
+		::snd_pcm_start(m_handle);
+	}
+}
+
 void CSoundALSAReader::kill()
 {
 	m_killed = true;
 }
 
-CSoundALSAWriter::CSoundALSAWriter(snd_pcm_t* handle, unsigned int blockSize, unsigned int channels, IAudioCallback* callback, int id) :
+CSoundALSAWriter::CSoundALSAWriter(snd_pcm_t* handle, unsigned int blockSize, unsigned int channels, bool mmap, IAudioCallback* callback, int id) :
 CThread(),
 m_handle(handle),
 m_blockSize(blockSize),
 m_channels(channels),
+m_mmap(mmap),
 m_callback(callback),
 m_id(id),
 m_killed(false),
@@ -272,6 +439,11 @@ void CSoundALSAWriter::entry()
 	LogMessage("Starting ALSA writer thread");
 
 	while (!m_killed) {
+		if (m_mmap) {
+			writeMMap();
+			continue;
+		}
+
 		int nSamples = 2 * m_blockSize;
 		m_callback->writeCallback(m_samples, nSamples, m_id);
 
@@ -298,6 +470,62 @@ void CSoundALSAWriter::entry()
 	::snd_pcm_close(m_handle);
 }
 
+void CSoundALSAWriter::writeMMap()
+{
+	snd_pcm_sframes_t avail = ::snd_pcm_avail_update(m_handle);
+	if (avail < 0) {
+		if (avail != -EPIPE)
+			LogWarning("snd_pcm_avail_update returned %d (%s)", avail, ::snd_strerror(avail));
+
+		::snd_pcm_recover(m_handle, avail, 1);
+		return;
+	}
+
+	if (avail < snd_pcm_sframes_t(m_blockSize)) {
+		int ret = ::snd_pcm_wait(m_handle, 100);
+		if (ret < 0)
+			::snd_pcm_recover(m_handle, ret, 1);
+		return;
+	}
+
+	const snd_pcm_channel_area_t* areas;
+	snd_pcm_uframes_t offset;
+	snd_pcm_uframes_t frames = m_blockSize;
+	int err = ::snd_pcm_mmap_begin(m_handle, &areas, &offset, &frames);
+	if (err < 0) {
+		LogWarning("snd_pcm_mmap_begin returned %d (%s)", err, ::snd_strerror(err));
+		::snd_pcm_recover(m_handle, err, 1);
+		return;
+	}
+
+	// With one channel the audio is written straight into the DMA buffer, otherwise it goes to every channel
+	float* samples = (float*)areas[0U].addr + areas[0U].first / 32U + offset * (areas[0U].step / 32U);
+
+	int nSamples = int(frames);
+	m_callback->writeCallback(m_channels == 1U ? samples : m_samples, nSamples, m_id);
+
+	if (m_channels > 1U) {
+		for (int i = 0; i < nSamples; i++) {
+			for (unsigned int j = 0U; j < m_channels; j++)
+				samples[i * m_channels + j] = m_samples[i];
+		}
+	}
+
+	snd_pcm_sframes_t ret = ::snd_pcm_mmap_commit(m_handle, offset, snd_pcm_uframes_t(nSamples));
+	if (ret < 0 || ret != nSamples) {
+		::snd_pcm_recover(m_handle, ret >= 0 ? -EPIPE : ret, 1);
+		return;
+	}
+
+	if (nSamples == 0) {
+		sleep(5UL);
+		return;
+	}
+
+	if (::snd_pcm_state(m_handle) == SND_PCM_STATE_PREPARED)
+		::snd_pcm_start(m_handle);
+}
+
 void CSoundALSAWriter::kill()
 {
 	m_killed = true;
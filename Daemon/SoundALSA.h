@@ -26,7 +26,7 @@
 
 class CSoundALSAReader : public CThread {
 public:
-	CSoundALSAReader(snd_pcm_t* handle, unsigned int blockSize, unsigned int channels, IAudioCallback* callback, int id);
+	CSoundALSAReader(snd_pcm_t* handle, unsigned int blockSize, unsigned int channels, bool mmap, IAudioCallback* callback, int id);
 	virtual ~CSoundALSAReader();
 
 	virtual void entry();
@@ -37,15 +37,18 @@ private:
 	snd_pcm_t*      m_handle;
 	unsigned int    m_blockSize;
 	unsigned int    m_channels;
+	bool            m_mmap;
 	IAudioCallback* m_callback;
 	int             m_id;
 	bool            m_killed;
 	float*          m_samples;
+
+	void readMMap();
 };
 
 class CSoundALSAWriter : public CThread {
 public:
-	CSoundALSAWriter(snd_pcm_t* handle, unsigned int blockSize, unsigned int channels, IAudioCallback* callback, int id);
+	CSoundALSAWriter(snd_pcm_t* handle, unsigned int blockSize, unsigned int channels, bool mmap, IAudioCallback* callback, int id);
 	virtual ~CSoundALSAWriter();
 
 	virtual void entry();
@@ -58,10 +61,13 @@ private:
 	snd_pcm_t*      m_handle;
 	unsigned int    m_blockSize;
 	unsigned int    m_channels;
+	bool            m_mmap;
 	IAudioCallback* m_callback;
 	int             m_id;
 	bool            m_killed;
 	float*          m_samples;
+
+	void writeMMap();
 };
 
 class CSoundALSA : public IAudioBackend {
@@ -69,6 +75,10 @@ public:
 	CSoundALSA(const std::string& readDevice, const std::string& writeDevice, unsigned int sampleRate, unsigned int blockSize);
 	~CSoundALSA();
 
+	// Use mmap access, so that the audio goes straight to and from the DMA buffer,
+	// and set the period and buffer lengths in ms, zero leaves them to the driver
+	void setBuffering(bool mmap, unsigned int periodTime, unsigned int bufferTime);
+
 	void setCallback(IAudioCallback* callback, int id = 0);
 	bool open();
 	void close();
@@ -80,10 +90,17 @@ private:
 	std::string       m_writeDevice;
 	unsigned int      m_sampleRate;
 	unsigned int      m_blockSize;
+	bool              m_mmap;
+	unsigned int      m_periodTime;
+	unsigned int      m_bufferTime;
 	IAudioCallback*   m_callback;
 	int               m_id;
 	CSoundALSAReader* m_reader;
 	CSoundALSAWriter* m_writer;
+
+	bool setAccess(snd_pcm_t* handle, snd_pcm_hw_params_t* params, bool& mmap);
+	void setBuffering(snd_pcm_t* handle, snd_pcm_hw_params_t* params);
+	bool setSoftware(snd_pcm_t* handle, bool mmap);
 };
 
 #endif
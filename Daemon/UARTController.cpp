@@ -22,21 +22,33 @@
 
 #include <cstring>
 #include <cassert>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
 
 #include <sys/types.h>
 #include <sys/ioctl.h>
 #include <sys/stat.h>
+#include <sys/select.h>
 #include <cerrno>
 #include <fcntl.h>
+#include <libgen.h>
 #include <unistd.h>
 #include <termios.h>
 
+#if defined(__linux__)
+#include <linux/serial.h>
+#endif
+
+// How long a low latency write waits for the kernel to take more data
+const int WRITE_WAIT_MS = 100;
 
 CUARTController::CUARTController(const std::string& device, unsigned int speed, bool assertRTS) :
 m_device(device),
 m_speed(speed),
 m_assertRTS(assertRTS),
-m_fd(-1)
+m_fd(-1),
+m_lowLatency(false)
 {
 	assert(!device.empty());
 }
@@ -45,7 +57,8 @@ CUARTController::CUARTController(unsigned int speed, bool assertRTS) :
 m_device(),
 m_speed(speed),
 m_assertRTS(assertRTS),
-m_fd(-1)
+m_fd(-1),
+m_lowLatency(false)
 {
 }
 
@@ -53,6 +66,13 @@ CUARTController::~CUARTController()
 {
 }
 
+void CUARTController::setLowLatency(bool lowLatency)
+{
+	assert(m_fd == -1);
+
+	m_lowLatency = lowLatency;
+}
+
 bool CUARTController::open()
 {
 	assert(m_fd == -1);
@@ -193,10 +213,28 @@ bool CUARTController::setRaw()
 		}
 	}
 
+#if defined(__linux__)
+	if (m_lowLatency) {
+		struct serial_struct serial;
+		if (::ioctl(m_fd, TIOCGSERIAL, &serial) == 0) {
+			serial.flags |= ASYNC_LOW_LATENCY;
+			if (::ioctl(m_fd, TIOCSSERIAL, &serial) < 0)
+				LogWarning("Cannot set low latency mode on %s, err=%d", m_device.c_str(), errno);
+		} else {
+			LogWarning("Cannot get the serial settings for %s, err=%d", m_device.c_str(), errno);
+		}
+
+		setLatencyTimer();
+	}
+#endif
+
 #if defined(__APPLE__)
 	setNonblock(false);
 #endif
 
+	if (m_lowLatency)
+		LogMessage("Opened %s in low latency mode", m_device.c_str());
+
 	return true;
 }
 
@@ -262,6 +300,27 @@ int CUARTController::read(unsigned char* buffer, unsigned int length)
 	return length;
 }
 
+int CUARTController::readAvailable(unsigned char* buffer, unsigned int length)
+{
+	assert(buffer != NULL);
+	assert(m_fd != -1);
+
+	if (length == 0U)
+		return 0;
+
+	// The port is non-blocking, so an empty read returns straight away without a select() first
+	ssize_t len = ::read(m_fd, buffer, length);
+	if (len < 0) {
+		if (errno == EAGAIN || errno == EWOULDBLOCK)
+			return 0;
+
+		LogError("Error from read(), errno=%d", errno);
+		return -1;
+	}
+
+	return int(len);
+}
+
 bool CUARTController::canWrite(){
 #if defined(__APPLE__)
 	fd_set wset;
@@ -300,6 +359,10 @@ int CUARTController::write(const unsigned char* buffer, unsigned int length)
 				LogError("Error returned from write(), errno=%d", errno);
 				return -1;
 			}
+
+			// Sleep until the kernel has drained some of its buffer rather than spinning
+			if (m_lowLatency && !waitWrite())
+				return -1;
 		}
 
 		if (n > 0)
@@ -309,6 +372,60 @@ int CUARTController::write(const unsigned char* buffer, unsigned int length)
 	return length;
 }
 
+bool CUARTController::flush()
+{
+	return true;
+}
+
+bool CUARTController::waitWrite()
+{
+	fd_set fds;
+	FD_ZERO(&fds);
+	FD_SET(m_fd, &fds);
+
+	struct timeval tv;
+	tv.tv_sec  = 0;
+	tv.tv_usec = WRITE_WAIT_MS * 1000;
+
+	int n = ::select(m_fd + 1, NULL, &fds, NULL, &tv);
+	if (n < 0 && errno != EINTR) {
+		LogError("Error from select(), errno=%d", errno);
+		return false;
+	}
+
+	if (n == 0)
+		LogWarning("Waited %d ms to write to %s", WRITE_WAIT_MS, m_device.c_str());
+
+	return true;
+}
+
+void CUARTController::setLatencyTimer()
+{
+	// USB serial adapters such as the FTDI hold received data for up to their
+	// latency timer, 16ms by default, before passing it to the host
+	char device[PATH_MAX];
+	if (::realpath(m_device.c_str(), device) == NULL)
+		return;
+
+	char path[PATH_MAX + 50U];
+	::snprintf(path, PATH_MAX + 50U, "/sys/class/tty/%s/device/latency_timer", ::basename(device));
+
+	// Not every adapter has one, but when it does it is normally only writable by root
+	FILE* fp = ::fopen(path, "w");
+	if (fp == NULL) {
+		if (errno != ENOENT)
+			LogWarning("Cannot open %s to set the USB latency timer, err=%d, it may need root or a udev rule", path, errno);
+		return;
+	}
+
+	if (::fputs("1", fp) < 0)
+		LogWarning("Cannot set the USB latency timer for %s", m_device.c_str());
+	else
+		LogMessage("Set the USB latency timer for %s to 1 ms", m_device.c_str());
+
+	::fclose(fp);
+}
+
 void CUARTController::close()
 {
 	assert(m_fd != -1);
@@ -317,3 +434,8 @@ void CUARTController::close()
 	m_fd = -1;
 }
 
+int CUARTController::getFD() const
+{
+	return m_fd;
+}
+
@@ -29,14 +29,23 @@ public:
 	CUARTController(const std::string& device, unsigned int speed, bool assertRTS = false);
 	virtual ~CUARTController();
 
+	// Must be called before open()
+	void setLowLatency(bool lowLatency);
+
 	virtual bool open();
 
 	virtual int read(unsigned char* buffer, unsigned int length);
 
+	virtual int readAvailable(unsigned char* buffer, unsigned int length);
+
 	virtual int write(const unsigned char* buffer, unsigned int length);
 
+	virtual bool flush();
+
 	virtual void close();
 
+	virtual int getFD() const;
+
 #if defined(__APPLE__)
 	virtual int setNonblock(bool nonblock);
 #endif
@@ -48,9 +57,12 @@ protected:
 	unsigned int   m_speed;
 	bool           m_assertRTS;
 	int            m_fd;
+	bool           m_lowLatency;
 
 	bool canWrite();
+	bool waitWrite();
 	bool setRaw();
+	void setLatencyTimer();
 };
 
 #endif
@@ -287,3 +287,10 @@ void CUDPSocket::close(const unsigned int index)
 	}
 }
 
+int CUDPSocket::getFD(const unsigned int index) const
+{
+	assert(index < UDP_SOCKET_MAX);
+
+	return m_fd[index];
+}
+
@@ -56,6 +56,8 @@ public:
 	void close();
 	void close(const unsigned int index);
 
+	int  getFD(const unsigned int index = 0U) const;
+
 	static int lookup(const std::string& hostName, unsigned short port, sockaddr_storage& address, unsigned int& address_length);
 	static int lookup(const std::string& hostName, unsigned short port, sockaddr_storage& address, unsigned int& address_length, struct addrinfo& hints);
 
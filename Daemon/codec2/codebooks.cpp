@@ -6,7 +6,7 @@
 #include "defines.h"
 
 /* codebook/lsp1.txt */
-static float codes00[] =
+alignas(16) static float codes00[] =
 {
 	225,
 	250,
@@ -26,7 +26,7 @@ static float codes00[] =
 	600
 };
 /* codebook/lsp2.txt */
-static float codes01[] =
+alignas(16) static float codes01[] =
 {
 	325,
 	350,
@@ -46,7 +46,7 @@ static float codes01[] =
 	700
 };
 /* codebook/lsp3.txt */
-static float codes02[] =
+alignas(16) static float codes02[] =
 {
 	500,
 	550,
@@ -66,7 +66,7 @@ static float codes02[] =
 	1250
 };
 /* codebook/lsp4.txt */
-static float codes03[] =
+alignas(16) static float codes03[] =
 {
 	700,
 	800,
@@ -86,7 +86,7 @@ static float codes03[] =
 	2200
 };
 /* codebook/lsp5.txt */
-static float codes04[] =
+alignas(16) static float codes04[] =
 {
 	950,
 	1050,
@@ -106,7 +106,7 @@ static float codes04[] =
 	2450
 };
 /* codebook/lsp6.txt */
-static float codes05[] =
+alignas(16) static float codes05[] =
 {
 	1100,
 	1200,
@@ -126,7 +126,7 @@ static float codes05[] =
 	2600
 };
 /* codebook/lsp7.txt */
-static float codes06[] =
+alignas(16) static float codes06[] =
 {
 	1500,
 	1600,
@@ -146,7 +146,7 @@ static float codes06[] =
 	3000
 };
 /* codebook/lsp8.txt */
-static float codes07[] =
+alignas(16) static float codes07[] =
 {
 	2300,
 	2400,
@@ -158,7 +158,7 @@ static float codes07[] =
 	3000
 };
 /* codebook/lsp9.txt */
-static float codes08[] =
+alignas(16) static float codes08[] =
 {
 	2500,
 	2600,
@@ -170,7 +170,7 @@ static float codes08[] =
 	3200
 };
 /* codebook/lsp10.txt */
-static float codes09[] =
+alignas(16) static float codes09[] =
 {
 	2900,
 	3100,
@@ -254,7 +254,7 @@ const struct lsp_codebook lsp_cb[] =
 };
 
 /* codebook/dlsp1.txt */
-static float codes10[] =
+alignas(16) static float codes10[] =
 {
 	25,
 	50,
@@ -290,7 +290,7 @@ static float codes10[] =
 	800
 };
 /* codebook/dlsp2.txt */
-static float codes11[] =
+alignas(16) static float codes11[] =
 {
 	25,
 	50,
@@ -326,7 +326,7 @@ static float codes11[] =
 	800
 };
 /* codebook/dlsp3.txt */
-static float codes12[] =
+alignas(16) static float codes12[] =
 {
 	25,
 	50,
@@ -362,7 +362,7 @@ static float codes12[] =
 	800
 };
 /* codebook/dlsp4.txt */
-static float codes13[] =
+alignas(16) static float codes13[] =
 {
 	25,
 	50,
@@ -398,7 +398,7 @@ static float codes13[] =
 	1400
 };
 /* codebook/dlsp5.txt */
-static float codes14[] =
+alignas(16) static float codes14[] =
 {
 	25,
 	50,
@@ -434,7 +434,7 @@ static float codes14[] =
 	1400
 };
 /* codebook/dlsp6.txt */
-static float codes15[] =
+alignas(16) static float codes15[] =
 {
 	25,
 	50,
@@ -470,7 +470,7 @@ static float codes15[] =
 	1400
 };
 /* codebook/dlsp7.txt */
-static float codes16[] =
+alignas(16) static float codes16[] =
 {
 	25,
 	50,
@@ -506,7 +506,7 @@ static float codes16[] =
 	800
 };
 /* codebook/dlsp8.txt */
-static float codes17[] =
+alignas(16) static float codes17[] =
 {
 	25,
 	50,
@@ -542,7 +542,7 @@ static float codes17[] =
 	800
 };
 /* codebook/dlsp9.txt */
-static float codes18[] =
+alignas(16) static float codes18[] =
 {
 	25,
 	50,
@@ -578,7 +578,7 @@ static float codes18[] =
 	800
 };
 /* codebook/dlsp10.txt */
-static float codes19[] =
+alignas(16) static float codes19[] =
 {
 	25,
 	50,
@@ -691,264 +691,74 @@ const struct lsp_codebook lsp_cbd[] =
 
 
 /* codebook/gecb.txt */
-static float codes30[] =
+alignas(16) static float codes30[] =
 {
-	2.71,  12.0184,
-	0.04675,  -2.73881,
-	0.120993,  8.38895,
-	-1.58028,  -0.892307,
-	1.19307,  -1.91561,
-	0.187101,  -3.27679,
-	0.332251,  -7.66455,
-	-1.47944,  31.2461,
-	1.52761,  27.7095,
-	-0.524379,  5.25012,
-	0.55333,  7.4388,
-	-0.843451,  -1.95299,
-	2.26389,  8.61029,
-	0.143143,  2.36549,
-	0.616506,  1.28427,
-	-1.71133,  22.0967,
-	1.00813,  17.3965,
-	-0.106718,  1.41891,
-	-0.136246,  14.2736,
-	-1.70909,  -20.5319,
-	1.65787,  -3.39107,
-	0.138049,  -4.95785,
-	0.536729,  -1.94375,
-	0.196307,  36.8519,
-	1.27248,  22.5565,
-	-0.670219,  -1.90604,
-	0.382092,  6.40113,
-	-0.756911,  -4.90102,
-	1.82931,  4.6138,
-	0.318794,  0.73683,
-	0.612815,  -2.07505,
-	-0.410151,  24.7871,
-	1.77602,  13.1909,
-	0.106457,  -0.104492,
-	0.192206,  10.1838,
-	-1.82442,  -7.71565,
-	0.931346,  4.34835,
-	0.308813,  -4.086,
-	0.397143,  -11.8089,
-	-0.048715,  41.2273,
-	0.877342,  35.8503,
-	-0.759794,  0.476634,
-	0.978593,  7.67467,
-	-1.19506,  3.03883,
-	2.63989,  -3.41106,
-	0.191127,  3.60351,
-	0.402932,  1.0843,
-	-2.15202,  18.1076,
-	1.5468,  8.32271,
-	-0.143089,  -4.07592,
-	-0.150142,  5.86674,
-	-1.40844,  -3.2507,
-	1.56615,  -10.4132,
-	0.178171,  -10.2267,
-	0.362164,  -0.028556,
-	-0.070125,  24.3907,
-	0.594752,  17.4828,
-	-0.28698,  -6.90407,
-	0.464818,  10.2055,
-	-1.00684,  -14.3572,
-	2.32957,  -3.69161,
-	0.335745,  2.40714,
-	1.01966,  -3.15565,
-	-1.25945,  7.9919,
-	2.38369,  19.6806,
-	-0.094947,  -2.41374,
-	0.20933,  6.66477,
-	-2.22103,  1.37986,
-	1.29239,  2.04633,
-	0.243626,  -0.890741,
-	0.428773,  -7.19366,
-	-1.11374,  41.3414,
-	2.6098,  31.1405,
-	-0.446468,  2.53419,
-	0.490104,  4.62757,
-	-1.11723,  -3.24174,
-	1.79156,  8.41493,
-	0.156012,  0.183336,
-	0.532447,  3.15455,
-	-0.764484,  18.514,
-	0.952395,  11.7713,
-	-0.332567,  0.346987,
-	0.202165,  14.7168,
-	-2.12924,  -15.559,
-	1.35358,  -1.92679,
-	-0.010963,  -16.3364,
-	0.399053,  -2.79057,
-	0.750657,  31.1483,
-	0.655743,  24.4819,
-	-0.45321,  -0.735879,
-	0.2869,  6.5467,
-	-0.715673,  -12.3578,
-	1.54849,  3.87217,
-	0.271874,  0.802339,
-	0.502073,  -4.85485,
-	-0.497037,  17.7619,
-	1.19116,  13.9544,
-	0.01563,  1.33157,
-	0.341867,  8.93537,
-	-2.31601,  -5.39506,
-	0.75861,  1.9645,
-	0.24132,  -3.23769,
-	0.267151,  -11.2344,
-	-0.273126,  32.6248,
-	1.75352,  40.432,
-	-0.784011,  3.04576,
-	0.705987,  5.66118,
-	-1.3864,  1.35356,
-	2.37646,  1.67485,
-	0.242973,  4.73218,
-	0.491227,  0.354061,
-	-1.60676,  8.65895,
-	1.16711,  5.9871,
-	-0.137601,  -12.0417,
-	-0.251375,  10.3972,
-	-1.43151,  -8.90411,
-	0.98828,  -13.209,
-	0.261484,  -6.35497,
-	0.395932,  -0.702529,
-	0.283704,  26.8996,
-	0.420959,  15.4418,
-	-0.355804,  -13.7278,
-	0.527372,  12.3985,
-	-1.16956,  -15.9985,
-	1.90669,  -5.81605,
-	0.354492,  3.85157,
-	0.82576,  -4.16264,
-	-0.49019,  13.0572,
-	2.25577,  13.5264,
-	-0.004956,  -3.23713,
-	0.026709,  7.86645,
-	-1.81037,  -0.451183,
-	1.08383,  -0.18362,
-	0.135836,  -2.26658,
-	0.375812,  -5.51225,
-	-1.96644,  38.6829,
-	1.97799,  24.5655,
-	-0.704656,  6.35881,
-	0.480786,  7.05175,
-	-0.976417,  -2.42273,
-	2.50215,  6.75935,
-	0.083588,  3.2588,
-	0.543629,  0.910013,
-	-1.23196,  23.0915,
-	0.785492,  14.807,
-	-0.213554,  1.688,
-	0.004748,  18.1718,
-	-1.54719,  -16.1168,
-	1.50104,  -3.28114,
-	0.080133,  -4.63472,
-	0.476592,  -2.18093,
-	0.44247,  40.304,
-	1.07277,  27.592,
-	-0.594738,  -4.16681,
-	0.42248,  7.61609,
-	-0.927521,  -7.27441,
-	1.99162,  1.29636,
-	0.291307,  2.39878,
-	0.721081,  -1.95062,
-	-0.804256,  24.9295,
-	1.64839,  19.1197,
-	0.060852,  -0.590639,
-	0.266085,  9.10325,
-	-1.9574,  -2.88461,
-	1.11693,  2.6724,
-	0.35458,  -2.74854,
-	0.330733,  -14.1561,
-	-0.527851,  39.5756,
-	0.991152,  43.195,
-	-0.589619,  1.26919,
-	0.787401,  8.73071,
-	-1.0138,  1.02507,
-	2.8254,  1.89538,
-	0.24089,  2.74557,
-	0.427195,  2.54446,
-	-1.95311,  12.244,
-	1.44862,  12.0607,
-	-0.210492,  -3.37906,
-	-0.056713,  10.204,
-	-1.65237,  -5.10274,
-	1.29475,  -12.2708,
-	0.111608,  -8.67592,
-	0.326634,  -1.16763,
-	0.021781,  31.1258,
-	0.455335,  21.4684,
-	-0.37544,  -3.37121,
-	0.39362,  11.302,
-	-0.851456,  -19.4149,
-	2.10703,  -2.22886,
-	0.373233,  1.92406,
-	0.884438,  -1.72058,
-	-0.975127,  9.84013,
-	2.0033,  17.3954,
-	-0.036915,  -1.11137,
-	0.148456,  5.39997,
-	-1.91441,  4.77382,
-	1.44791,  0.537122,
-	0.194979,  -1.03818,
-	0.495771,  -9.95502,
-	-1.05899,  32.9471,
-	2.01122,  32.4544,
-	-0.30965,  4.71911,
-	0.436082,  4.63552,
-	-1.23711,  -1.25428,
-	2.02274,  9.42834,
-	0.190342,  1.46077,
-	0.479017,  2.48479,
-	-1.07848,  16.2217,
-	1.20764,  9.65421,
-	-0.258087,  -1.67236,
-	0.071852,  13.416,
-	-1.87723,  -16.072,
-	1.28957,  -4.87118,
-	0.067713,  -13.4427,
-	0.435551,  -4.1655,
-	0.46614,  30.5895,
-	0.904895,  21.598,
-	-0.518369,  -2.53205,
-	0.337363,  5.63726,
-	-0.554975,  -17.4005,
-	1.69188,  1.14574,
-	0.227934,  0.889297,
-	0.587303,  -5.72973,
-	-0.262133,  18.6666,
-	1.39505,  17.0029,
-	-0.01909,  4.30838,
-	0.304235,  12.6699,
-	-2.07406,  -6.46084,
-	0.920546,  1.21296,
-	0.284927,  -1.78547,
-	0.209724,  -16.024,
-	-0.636067,  31.5768,
-	1.34989,  34.6775,
-	-0.971625,  5.30086,
-	0.590249,  4.44971,
-	-1.56787,  3.60239,
-	2.1455,  4.51666,
-	0.296022,  4.12017,
-	0.445299,  0.868772,
-	-1.44193,  14.1284,
-	1.35575,  6.0074,
-	-0.012814,  -7.49657,
-	-0.43,  8.50012,
-	-1.20469,  -7.11326,
-	1.10102,  -6.83682,
-	0.196463,  -6.234,
-	0.436747,  -1.12979,
-	0.141052,  22.8549,
-	0.290821,  18.8114,
-	-0.529536,  -7.73251,
-	0.63428,  10.7898,
-	-1.33472,  -20.3258,
-	1.81564,  -1.90332,
-	0.394778,  3.79758,
-	0.732682,  -8.18382,
-	-0.741244,  11.7683
+	/* element 0 of each vector */
+	2.71,  0.04675,  0.120993,  -1.58028,  1.19307,  0.187101,  0.332251,  -1.47944,
+	1.52761,  -0.524379,  0.55333,  -0.843451,  2.26389,  0.143143,  0.616506,  -1.71133,
+	1.00813,  -0.106718,  -0.136246,  -1.70909,  1.65787,  0.138049,  0.536729,  0.196307,
+	1.27248,  -0.670219,  0.382092,  -0.756911,  1.82931,  0.318794,  0.612815,  -0.410151,
+	1.77602,  0.106457,  0.192206,  -1.82442,  0.931346,  0.308813,  0.397143,  -0.048715,
+	0.877342,  -0.759794,  0.978593,  -1.19506,  2.63989,  0.191127,  0.402932,  -2.15202,
+	1.5468,  -0.143089,  -0.150142,  -1.40844,  1.56615,  0.178171,  0.362164,  -0.070125,
+	0.594752,  -0.28698,  0.464818,  -1.00684,  2.32957,  0.335745,  1.01966,  -1.25945,
+	2.38369,  -0.094947,  0.20933,  -2.22103,  1.29239,  0.243626,  0.428773,  -1.11374,
+	2.6098,  -0.446468,  0.490104,  -1.11723,  1.79156,  0.156012,  0.532447,  -0.764484,
+	0.952395,  -0.332567,  0.202165,  -2.12924,  1.35358,  -0.010963,  0.399053,  0.750657,
+	0.655743,  -0.45321,  0.2869,  -0.715673,  1.54849,  0.271874,  0.502073,  -0.497037,
+	1.19116,  0.01563,  0.341867,  -2.31601,  0.75861,  0.24132,  0.267151,  -0.273126,
+	1.75352,  -0.784011,  0.705987,  -1.3864,  2.37646,  0.242973,  0.491227,  -1.60676,
+	1.16711,  -0.137601,  -0.251375,  -1.43151,  0.98828,  0.261484,  0.395932,  0.283704,
+	0.420959,  -0.355804,  0.527372,  -1.16956,  1.90669,  0.354492,  0.82576,  -0.49019,
+	2.25577,  -0.004956,  0.026709,  -1.81037,  1.08383,  0.135836,  0.375812,  -1.96644,
+	1.97799,  -0.704656,  0.480786,  -0.976417,  2.50215,  0.083588,  0.543629,  -1.23196,
+	0.785492,  -0.213554,  0.004748,  -1.54719,  1.50104,  0.080133,  0.476592,  0.44247,
+	1.07277,  -0.594738,  0.42248,  -0.927521,  1.99162,  0.291307,  0.721081,  -0.804256,
+	1.64839,  0.060852,  0.266085,  -1.9574,  1.11693,  0.35458,  0.330733,  -0.527851,
+	0.991152,  -0.589619,  0.787401,  -1.0138,  2.8254,  0.24089,  0.427195,  -1.95311,
+	1.44862,  -0.210492,  -0.056713,  -1.65237,  1.29475,  0.111608,  0.326634,  0.021781,
+	0.455335,  -0.37544,  0.39362,  -0.851456,  2.10703,  0.373233,  0.884438,  -0.975127,
+	2.0033,  -0.036915,  0.148456,  -1.91441,  1.44791,  0.194979,  0.495771,  -1.05899,
+	2.01122,  -0.30965,  0.436082,  -1.23711,  2.02274,  0.190342,  0.479017,  -1.07848,
+	1.20764,  -0.258087,  0.071852,  -1.87723,  1.28957,  0.067713,  0.435551,  0.46614,
+	0.904895,  -0.518369,  0.337363,  -0.554975,  1.69188,  0.227934,  0.587303,  -0.262133,
+	1.39505,  -0.01909,  0.304235,  -2.07406,  0.920546,  0.284927,  0.209724,  -0.636067,
+	1.34989,  -0.971625,  0.590249,  -1.56787,  2.1455,  0.296022,  0.445299,  -1.44193,
+	1.35575,  -0.012814,  -0.43,  -1.20469,  1.10102,  0.196463,  0.436747,  0.141052,
+	0.290821,  -0.529536,  0.63428,  -1.33472,  1.81564,  0.394778,  0.732682,  -0.741244,
+	/* element 1 of each vector */
+	12.0184,  -2.73881,  8.38895,  -0.892307,  -1.91561,  -3.27679,  -7.66455,  31.2461,
+	27.7095,  5.25012,  7.4388,  -1.95299,  8.61029,  2.36549,  1.28427,  22.0967,
+	17.3965,  1.41891,  14.2736,  -20.5319,  -3.39107,  -4.95785,  -1.94375,  36.8519,
+	22.5565,  -1.90604,  6.40113,  -4.90102,  4.6138,  0.73683,  -2.07505,  24.7871,
+	13.1909,  -0.104492,  10.1838,  -7.71565,  4.34835,  -4.086,  -11.8089,  41.2273,
+	35.8503,  0.476634,  7.67467,  3.03883,  -3.41106,  3.60351,  1.0843,  18.1076,
+	8.32271,  -4.07592,  5.86674,  -3.2507,  -10.4132,  -10.2267,  -0.028556,  24.3907,
+	17.4828,  -6.90407,  10.2055,  -14.3572,  -3.69161,  2.40714,  -3.15565,  7.9919,
+	19.6806,  -2.41374,  6.66477,  1.37986,  2.04633,  -0.890741,  -7.19366,  41.3414,
+	31.1405,  2.53419,  4.62757,  -3.24174,  8.41493,  0.183336,  3.15455,  18.514,
+	11.7713,  0.346987,  14.7168,  -15.559,  -1.92679,  -16.3364,  -2.79057,  31.1483,
+	24.4819,  -0.735879,  6.5467,  -12.3578,  3.87217,  0.802339,  -4.85485,  17.7619,
+	13.9544,  1.33157,  8.93537,  -5.39506,  1.9645,  -3.23769,  -11.2344,  32.6248,
+	40.432,  3.04576,  5.66118,  1.35356,  1.67485,  4.73218,  0.354061,  8.65895,
+	5.9871,  -12.0417,  10.3972,  -8.90411,  -13.209,  -6.35497,  -0.702529,  26.8996,
+	15.4418,  -13.7278,  12.3985,  -15.9985,  -5.81605,  3.85157,  -4.16264,  13.0572,
+	13.5264,  -3.23713,  7.86645,  -0.451183,  -0.18362,  -2.26658,  -5.51225,  38.6829,
+	24.5655,  6.35881,  7.05175,  -2.42273,  6.75935,  3.2588,  0.910013,  23.0915,
+	14.807,  1.688,  18.1718,  -16.1168,  -3.28114,  -4.63472,  -2.18093,  40.304,
+	27.592,  -4.16681,  7.61609,  -7.27441,  1.29636,  2.39878,  -1.95062,  24.9295,
+	19.1197,  -0.590639,  9.10325,  -2.88461,  2.6724,  -2.74854,  -14.1561,  39.5756,
+	43.195,  1.26919,  8.73071,  1.02507,  1.89538,  2.74557,  2.54446,  12.244,
+	12.0607,  -3.37906,  10.204,  -5.10274,  -12.2708,  -8.67592,  -1.16763,  31.1258,
+	21.4684,  -3.37121,  11.302,  -19.4149,  -2.22886,  1.92406,  -1.72058,  9.84013,
+	17.3954,  -1.11137,  5.39997,  4.77382,  0.537122,  -1.03818,  -9.95502,  32.9471,
+	32.4544,  4.71911,  4.63552,  -1.25428,  9.42834,  1.46077,  2.48479,  16.2217,
+	9.65421,  -1.67236,  13.416,  -16.072,  -4.87118,  -13.4427,  -4.1655,  30.5895,
+	21.598,  -2.53205,  5.63726,  -17.4005,  1.14574,  0.889297,  -5.72973,  18.6666,
+	17.0029,  4.30838,  12.6699,  -6.46084,  1.21296,  -1.78547,  -16.024,  31.5768,
+	34.6775,  5.30086,  4.44971,  3.60239,  4.51666,  4.12017,  0.868772,  14.1284,
+	6.0074,  -7.49657,  8.50012,  -7.11326,  -6.83682,  -6.234,  -1.12979,  22.8549,
+	18.8114,  -7.73251,  10.7898,  -20.3258,  -1.90332,  3.79758,  -8.18382,  11.7683
 };
 
 const struct lsp_codebook ge_cb[] =
@@ -38,6 +38,7 @@
 #include "quantise.h"
 #include "codec2.h"
 #include "codec2_internal.h"
+#include "fastmath.h"
 
 #define HPF_BETA 0.125
 #define BPF_N 101
@@ -65,40 +66,63 @@ CKissFFT kiss;
   AUTHOR......: David Rowe
   DATE CREATED: 21/8/2010
 
-  Create and initialise an instance of the codec.  Returns a pointer
-  to the codec states or NULL on failure.  One set of states is
-  sufficient for a full duuplex codec (i.e. an encoder and decoder).
-  You don't need separate states for encoders and decoders.  See
-  c2enc.c and c2dec.c for examples.
+  Create and initialise an instance of the codec.  One set of states is
+  sufficient for a full duplex codec (i.e. an encoder and decoder), but
+  the two directions then share it and cannot run concurrently.  Passing
+  encoder or decoder as false skips allocating the state for that
+  direction; CCodec2Encoder and CCodec2Decoder wrap this.
 
 \*---------------------------------------------------------------------------*/
 
-CCodec2::CCodec2(bool is_3200)
+CCodec2::CCodec2(bool is_3200, bool encoder, bool decoder)
 {
+	assert(encoder || decoder);
+
 	c2.mode = is_3200 ? 3200 : 1600;
 
+	/* the windows and FFT configs are shared by every instance */
+
+	const CODEC2_TABLES &tables = codec2_tables();
+
 	/* store constants in a few places for convenience */
 
-	c2.c2const = c2const_create(8000, N_S);
+	c2.c2const = tables.c2const;
 	c2.Fs = c2.c2const.Fs;
 	int n_samp = c2.n_samp = c2.c2const.n_samp;
 	int m_pitch = c2.m_pitch = c2.c2const.m_pitch;
 
-	c2.Pn.resize(2*n_samp);
-	c2.Sn_.resize(2*n_samp);
-	c2.w.resize(m_pitch);
-	c2.Sn.resize(m_pitch);
+	c2.w = tables.w.data();
+	c2.W = tables.W;
+	c2.fft_fwd_cfg = &tables.fft_fwd_cfg;
+	c2.Pn = tables.Pn.data();
+	c2.fftr_fwd_cfg = &tables.fftr_fwd_cfg;
+	c2.fftr_inv_cfg = &tables.fftr_inv_cfg;
+
+	/* only allocate the buffers for the direction(s) in use */
+
+	if (encoder)
+	{
+		c2.Sn.resize(m_pitch);
+
+		for(int i=0; i<m_pitch; i++)
+			c2.Sn[i] = 1.0;
+
+		nlp.nlp_create(&c2.c2const, tables.nlp_w.data(), &tables.fft_fwd_cfg);
+
+		c2.bpf_buf.resize(BPF_N+4*c2.n_samp);
+		for(int i=0; i<BPF_N+4*c2.n_samp; i++)
+			c2.bpf_buf[i] = 0.0;
+	}
+
+	if (decoder)
+	{
+		c2.Sn_.resize(2*n_samp);
+
+		for(int i=0; i<2*n_samp; i++)
+			c2.Sn_[i] = 0;
+	}
 
-	for(int i=0; i<m_pitch; i++)
-		c2.Sn[i] = 1.0;
 	c2.hpf_states[0] = c2.hpf_states[1] = 0.0;
-	for(int i=0; i<2*n_samp; i++)
-		c2.Sn_[i] = 0;
-	kiss.fft_alloc(c2.fft_fwd_cfg, FFT_ENC, false);
-	kiss.fftr_alloc(c2.fftr_fwd_cfg, FFT_ENC, false);
-	make_analysis_window(&c2.c2const, &c2.fft_fwd_cfg, c2.w.data(), c2.W);
-	make_synthesis_window(&c2.c2const, c2.Pn.data());
-	kiss.fftr_alloc(c2.fftr_inv_cfg, FFT_DEC, true);
 	c2.prev_f0_enc = 1/P_MAX_S;
 	c2.bg_est = 0.0;
 	c2.ex_phase = 0.0;
@@ -115,8 +139,6 @@ CCodec2::CCodec2(bool is_3200)
 	}
 	c2.prev_e_dec = 1;
 
-	nlp.nlp_create(&c2.c2const);
-
 	c2.lpc_pf = 1;
 	c2.bass_boost = 1;
 	c2.beta = LPCPF_BETA;
@@ -126,31 +148,17 @@ CCodec2::CCodec2(bool is_3200)
 	c2.xq_dec[0] = c2.xq_dec[1] = 0.0;
 
 	c2.smoothing = 0;
-
-	c2.bpf_buf.resize(BPF_N+4*c2.n_samp);
-	for(int i=0; i<BPF_N+4*c2.n_samp; i++)
-		c2.bpf_buf[i] = 0.0;
+	c2.fast_math = CODEC2_FAST_MATH_DEFAULT ? 1 : 0;
+	c2.rand_next = 1;
 
 	c2.softdec = NULL;
 	c2.gray = 1;
 
-	// make sure that one of the two decode function pointers is empty
-	// for the encode function pointer this is not required since we always set it
-	// to a meaningful value
-
-	decode = NULL;
+	m_encoder = encoder;
+	m_decoder = decoder;
 	m_decode_gain = 1.0f;
 
-	if ( 3200 == c2.mode)
-	{
-		encode = &CCodec2::codec2_encode_3200;
-		decode = &CCodec2::codec2_decode_3200;
-	}
-	else
-	{
-		encode = &CCodec2::codec2_encode_1600;
-		decode = &CCodec2::codec2_decode_1600;
-	}
+	codec2_set_mode(is_3200);
 }
 
 /*---------------------------------------------------------------------------*\
@@ -167,29 +175,65 @@ CCodec2::~CCodec2()
 {
 	c2.bpf_buf.clear();
 	nlp.nlp_destroy();
-	c2.fft_fwd_cfg.twiddles.clear();
-	c2.fftr_fwd_cfg.substate.twiddles.clear();
-	c2.fftr_fwd_cfg.tmpbuf.clear();
-	c2.fftr_fwd_cfg.super_twiddles.clear();
-	c2.fftr_inv_cfg.substate.twiddles.clear();
-	c2.fftr_inv_cfg.tmpbuf.clear();
-	c2.fftr_inv_cfg.super_twiddles.clear();
-	c2.Pn.clear();
 	c2.Sn.clear();
-	c2.w.clear();
 	c2.Sn_.clear();
 }
 
+/*---------------------------------------------------------------------------*\
+
+  FUNCTION....: codec2_tables
+
+  Returns the windows and FFT configs, building them the first time that
+  a codec is created.  They are read only from then on and shared by
+  every instance, whatever its mode or direction.
+
+\*---------------------------------------------------------------------------*/
+
+const CODEC2_TABLES &CCodec2::codec2_tables()
+{
+	static const CODEC2_TABLES tables = []() {
+		CODEC2_TABLES t;
+
+		t.c2const = c2const_create(8000, N_S);
+
+		kiss.fft_alloc(t.fft_fwd_cfg, FFT_ENC, false);
+		kiss.fftr_alloc(t.fftr_fwd_cfg, FFT_ENC, false);
+		kiss.fftr_alloc(t.fftr_inv_cfg, FFT_DEC, true);
+
+		t.w.resize(t.c2const.m_pitch);
+		make_analysis_window(&t.c2const, &t.fft_fwd_cfg, t.w.data(), t.W);
+
+		t.Pn.resize(2*t.c2const.n_samp);
+		make_synthesis_window(&t.c2const, t.Pn.data());
+
+		t.nlp_w.resize(PMAX_M/DEC);
+		Cnlp::nlp_make_window(&t.c2const, t.nlp_w.data());
+
+		return t;
+	}();
+
+	return tables;
+}
+
 void CCodec2::codec2_set_mode(bool m)
 {
 	c2.mode = m ? 3200 : 1600;
+
+	// leave the pointer for an unallocated direction empty so that misuse trips the assert
+	encode = NULL;
+	decode = NULL;
+
 	if (c2.mode == 3200){
-		encode = &CCodec2::codec2_encode_3200;
-		decode = &CCodec2::codec2_decode_3200;
+		if (m_encoder)
+			encode = &CCodec2::codec2_encode_3200;
+		if (m_decoder)
+			decode = &CCodec2::codec2_decode_3200;
 	}
 	else{
-		encode = &CCodec2::codec2_encode_1600;
-		decode = &CCodec2::codec2_decode_1600;
+		if (m_encoder)
+			encode = &CCodec2::codec2_encode_1600;
+		if (m_decoder)
+			decode = &CCodec2::codec2_decode_1600;
 	}
 }
 
@@ -294,7 +338,7 @@ void CCodec2::codec2_encode_3200(unsigned char *bits, const short *speech)
 	Wo_index = qt.encode_Wo(&c2.c2const, model.Wo, WO_BITS);
 	qt.pack(bits, &nbit, Wo_index, WO_BITS);
 
-	e = qt.speech_to_uq_lsps(lsps, ak, c2.Sn.data(), c2.w.data(), c2.m_pitch, LPC_ORD);
+	e = qt.speech_to_uq_lsps(lsps, ak, c2.Sn.data(), c2.w, c2.m_pitch, LPC_ORD);
 	e_index = qt.encode_energy(e, E_BITS);
 	qt.pack(bits, &nbit, e_index, E_BITS);
 
@@ -373,7 +417,7 @@ void CCodec2::codec2_decode_3200(short speech[], const unsigned char * bits)
 	for(i=0; i<2; i++)
 	{
 		lsp_to_lpc(&lsps[i][0], &ak[i][0], LPC_ORD);
-		qt.aks_to_M2(&(c2.fftr_fwd_cfg), &ak[i][0], LPC_ORD, &model[i], e[i], &snr, 0, c2.lpc_pf, c2.bass_boost, c2.beta, c2.gamma, Aw);
+		qt.aks_to_M2(c2.fftr_fwd_cfg, &ak[i][0], LPC_ORD, &model[i], e[i], &snr, 0, c2.lpc_pf, c2.bass_boost, c2.beta, c2.gamma, c2.fast_math, Aw);
 		qt.apply_lpc_correction(&model[i]);
 		synthesise_one_frame(&speech[c2.n_samp*i], &model[i], Aw, m_decode_gain);
 	}
@@ -441,7 +485,7 @@ void CCodec2::codec2_encode_1600(unsigned char * bits, const short speech[])
 	qt.pack(bits, &nbit, Wo_index, WO_BITS);
 
 	/* need to run this just to get LPC energy */
-	e = qt.speech_to_uq_lsps(lsps, ak, c2.Sn.data(), c2.w.data(), c2.m_pitch, LPC_ORD);
+	e = qt.speech_to_uq_lsps(lsps, ak, c2.Sn.data(), c2.w, c2.m_pitch, LPC_ORD);
 	e_index = qt.encode_energy(e, E_BITS);
 	qt.pack(bits, &nbit, e_index, E_BITS);
 
@@ -458,7 +502,7 @@ void CCodec2::codec2_encode_1600(unsigned char * bits, const short speech[])
 	Wo_index = qt.encode_Wo(&c2.c2const, model.Wo, WO_BITS);
 	qt.pack(bits, &nbit, Wo_index, WO_BITS);
 
-	e = qt.speech_to_uq_lsps(lsps, ak, c2.Sn.data(), c2.w.data(), c2.m_pitch, LPC_ORD);
+	e = qt.speech_to_uq_lsps(lsps, ak, c2.Sn.data(), c2.w, c2.m_pitch, LPC_ORD);
 	e_index = qt.encode_energy(e, E_BITS);
 	qt.pack(bits, &nbit, e_index, E_BITS);
 
@@ -555,7 +599,7 @@ void CCodec2::codec2_decode_1600(short speech[], const unsigned char * bits)
 	for(i=0; i<4; i++)
 	{
 		lsp_to_lpc(&lsps[i][0], &ak[i][0], LPC_ORD);
-		qt.aks_to_M2(&(c2.fftr_fwd_cfg), &ak[i][0], LPC_ORD, &model[i], e[i], &snr, 0, c2.lpc_pf, c2.bass_boost, c2.beta, c2.gamma, Aw);
+		qt.aks_to_M2(c2.fftr_fwd_cfg, &ak[i][0], LPC_ORD, &model[i], e[i], &snr, 0, c2.lpc_pf, c2.bass_boost, c2.beta, c2.gamma, c2.fast_math, Aw);
 		qt.apply_lpc_correction(&model[i]);
 		synthesise_one_frame(&speech[c2.n_samp*i], &model[i], Aw, m_decode_gain);
 	}
@@ -589,7 +633,7 @@ void CCodec2::synthesise_one_frame(short speech[], MODEL *model, std::complex<fl
 	phase_synth_zero_order(c2.n_samp, model, &c2.ex_phase, H);
 
 	postfilter(model, &c2.bg_est);
-	synthesise(c2.n_samp, &(c2.fftr_inv_cfg), c2.Sn_.data(), model, c2.Pn.data(), 1);
+	synthesise(c2.n_samp, c2.fftr_inv_cfg, c2.Sn_.data(), model, c2.Pn, 1);
 
 	for(i=0; i<c2.n_samp; i++)
 	{
@@ -636,7 +680,7 @@ void CCodec2::analyse_one_frame(MODEL *model, const short *speech)
 	for(i=0; i<n_samp; i++)
 		c2.Sn[i+m_pitch-n_samp] = speech[i];
 
-	dft_speech(&c2.c2const, c2.fft_fwd_cfg, Sw, c2.Sn.data(), c2.w.data());
+	dft_speech(&c2.c2const, *c2.fft_fwd_cfg, Sw, c2.Sn.data(), c2.w);
 
 	/* Estimate pitch */
 	nlp.nlp(c2.Sn.data(), n_samp, &pitch, &c2.prev_f0_enc);
@@ -844,7 +888,14 @@ void CCodec2::phase_synth_zero_order(
 
 		if (model->voiced)
 		{
-			Ex[m] = std::polar(1.0f, ex_phase[0] * m);
+			if (c2.fast_math)
+			{
+				float s, c;
+				fast_sincosf(ex_phase[0] * m, &s, &c);
+				Ex[m] = std::complex<float>(c, s);
+			}
+			else
+				Ex[m] = std::polar(1.0f, ex_phase[0] * m);
 		}
 		else
 		{
@@ -854,7 +905,14 @@ void CCodec2::phase_synth_zero_order(
 			   keeping it.
 			*/
 			float phi = TWO_PI*(float)codec2_rand()/CODEC2_RAND_MAX;
-			Ex[m] = std::polar(1.0f, phi);
+			if (c2.fast_math)
+			{
+				float s, c;
+				fast_sincosf(phi, &s, &c);
+				Ex[m] = std::complex<float>(c, s);
+			}
+			else
+				Ex[m] = std::polar(1.0f, phi);
 		}
 
 		/* filter using LPC filter */
@@ -864,7 +922,10 @@ void CCodec2::phase_synth_zero_order(
 
 		/* modify sinusoidal phase */
 
-		new_phi = atan2f(A_[m].imag(), A_[m].real()+1E-12);
+		if (c2.fast_math)
+			new_phi = fast_atan2f(A_[m].imag(), A_[m].real()+1E-12);
+		else
+			new_phi = atan2f(A_[m].imag(), A_[m].real()+1E-12);
 		model->phi[m] = new_phi;
 	}
 
@@ -935,7 +996,10 @@ void CCodec2::postfilter( MODEL *model, float *bg_est )
 		e += model->A[m]*model->A[m];
 
 	assert(e > 0.0);
-	e = 10.0*log10f(e/model->L);
+	if (c2.fast_math)
+		e = 10.0*fast_log10f(e/model->L);
+	else
+		e = 10.0*log10f(e/model->L);
 
 	/* If beneath threhold, update bg estimate.  The idea
 	   of the threshold is to prevent updating during high level
@@ -949,7 +1013,10 @@ void CCodec2::postfilter( MODEL *model, float *bg_est )
 	*/
 
 	uv = 0;
-	thresh = exp10f((*bg_est + BG_MARGIN)/20.0);
+	if (c2.fast_math)
+		thresh = fast_exp10f((*bg_est + BG_MARGIN)/20.0);
+	else
+		thresh = exp10f((*bg_est + BG_MARGIN)/20.0);
 	if (model->voiced)
 		for(m=1; m<=model->L; m++)
 			if (model->A[m] < thresh)
@@ -1004,7 +1071,7 @@ C2CONST CCodec2::c2const_create(int Fs, float framelength_s)
 
 \*---------------------------------------------------------------------------*/
 
-void CCodec2::make_analysis_window(C2CONST *c2const, FFT_STATE *fft_fwd_cfg, float w[], float W[])
+void CCodec2::make_analysis_window(C2CONST *c2const, const FFT_STATE *fft_fwd_cfg, float w[], float W[])
 {
 	float m;
 	std::complex<float>  wshift[FFT_ENC];
@@ -1119,7 +1186,7 @@ void CCodec2::make_analysis_window(C2CONST *c2const, FFT_STATE *fft_fwd_cfg, flo
 
 \*---------------------------------------------------------------------------*/
 
-void CCodec2::dft_speech(C2CONST *c2const, FFT_STATE &fft_fwd_cfg, std::complex<float> Sw[], float Sn[], float w[])
+void CCodec2::dft_speech(C2CONST *c2const, const FFT_STATE &fft_fwd_cfg, std::complex<float> Sw[], float Sn[], const float w[])
 {
     int  i;
     int  m_pitch = c2const->m_pitch;
@@ -1309,7 +1376,7 @@ void CCodec2::estimate_amplitudes(MODEL *model, std::complex<float> Sw[], int es
 
 \*---------------------------------------------------------------------------*/
 
-float CCodec2::est_voicing_mbe( C2CONST *c2const, MODEL *model, std::complex<float> Sw[], float  W[])
+float CCodec2::est_voicing_mbe( C2CONST *c2const, MODEL *model, std::complex<float> Sw[], const float W[])
 {
 	int   l,al,bl,m;    /* loop variables */
 	std::complex<float>  Am;             /* amplitude sample for this band */
@@ -1467,10 +1534,10 @@ void CCodec2::make_synthesis_window(C2CONST *c2const, float Pn[])
 
 void CCodec2::synthesise(
 	int    n_samp,
-	FFTR_STATE *fftr_inv_cfg,
+	const FFTR_STATE *fftr_inv_cfg,
 	float  Sn_[],		/* time domain synthesised signal              */
 	MODEL *model,		/* ptr to model parameters for this frame      */
-	float  Pn[],		/* time domain Parzen window                   */
+	const float Pn[],	/* time domain Parzen window                   */
 	int    shift          /* flag used to handle transition frames       */
 )
 {
@@ -1503,7 +1570,14 @@ void CCodec2::synthesise(
 		{
 			b = (FFT_DEC/2)-1;
 		}
-		Sw_[b] = std::polar(model->A[l], model->phi[l]);
+		if (c2.fast_math)
+		{
+			float s, c;
+			fast_sincosf(model->phi[l], &s, &c);
+			Sw_[b] = std::complex<float>(model->A[l] * c, model->A[l] * s);
+		}
+		else
+			Sw_[b] = std::polar(model->A[l], model->phi[l]);
 	}
 
 	/* Perform inverse DFT */
@@ -1525,11 +1599,12 @@ void CCodec2::synthesise(
 			Sn_[i] += sw_[j]*Pn[i];
 }
 
+/* the state is per instance so that decoders on different threads don't race */
+
 int CCodec2::codec2_rand(void)
 {
-	static unsigned long next = 1;
-	next = next * 1103515245 + 12345;
-	return((unsigned)(next/65536) % 32768);
+	c2.rand_next = c2.rand_next * 1103515245 + 12345;
+	return((unsigned)(c2.rand_next/65536) % 32768);
 }
 
 /*---------------------------------------------------------------------------*\
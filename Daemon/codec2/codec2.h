@@ -49,7 +49,7 @@
 class CCodec2
 {
 public:
-	CCodec2(bool is_3200);
+	CCodec2(bool is_3200, bool encoder = true, bool decoder = true);
 	~CCodec2();
 	void codec2_encode(unsigned char *bits, const short *speech_in);
 	void codec2_decode(short *speech_out, const unsigned char *bits);
@@ -58,6 +58,7 @@ public:
 	int  codec2_samples_per_frame();
 	int  codec2_bits_per_frame();
 	void set_decode_gain(float g){ m_decode_gain = g; }
+	void codec2_set_fast_math(bool on) { c2.fast_math = on ? 1 : 0; }
 
 private:
 	// merged from other files
@@ -65,15 +66,16 @@ private:
 	void phase_synth_zero_order(int n_samp, MODEL *model, float *ex_phase, std::complex<float> filter_phase[]);
 	void postfilter(MODEL *model, float *bg_est);
 
-	C2CONST c2const_create(int Fs, float framelength_ms);
+	static C2CONST c2const_create(int Fs, float framelength_ms);
+	static const CODEC2_TABLES &codec2_tables();
 
-	void make_analysis_window(C2CONST *c2const, FFT_STATE *fft_fwd_cfg, float w[], float W[]);
-	void dft_speech(C2CONST *c2const, FFT_STATE &fft_fwd_cfg, std::complex<float> Sw[], float Sn[], float w[]);
+	static void make_analysis_window(C2CONST *c2const, const FFT_STATE *fft_fwd_cfg, float w[], float W[]);
+	void dft_speech(C2CONST *c2const, const FFT_STATE &fft_fwd_cfg, std::complex<float> Sw[], float Sn[], const float w[]);
 	void two_stage_pitch_refinement(C2CONST *c2const, MODEL *model, std::complex<float> Sw[]);
 	void estimate_amplitudes(MODEL *model, std::complex<float> Sw[], int est_phase);
-	float est_voicing_mbe(C2CONST *c2const, MODEL *model, std::complex<float> Sw[], float W[]);
-	void make_synthesis_window(C2CONST *c2const, float Pn[]);
-	void synthesise(int n_samp, FFTR_STATE *fftr_inv_cfg, float Sn_[], MODEL *model, float Pn[], int shift);
+	float est_voicing_mbe(C2CONST *c2const, MODEL *model, std::complex<float> Sw[], const float W[]);
+	static void make_synthesis_window(C2CONST *c2const, float Pn[]);
+	void synthesise(int n_samp, const FFTR_STATE *fftr_inv_cfg, float Sn_[], MODEL *model, const float Pn[], int shift);
 	int codec2_rand(void);
 	void hs_pitch_refinement(MODEL *model, std::complex<float> Sw[], float pmin, float pmax, float pstep);
 
@@ -96,7 +98,43 @@ private:
 	Cnlp nlp;
 	CQuantize qt;
 	CODEC2 c2;
+	bool m_encoder;
+	bool m_decoder;
 	float m_decode_gain;
 };
 
+/*
+  Single direction codecs.  Each owns only the state that its direction
+  needs, so an encoder and a decoder never share anything and may be run
+  on different threads at the same time.
+*/
+
+class CCodec2Encoder
+{
+public:
+	CCodec2Encoder(bool is_3200) : m_codec(is_3200, true, false) {}
+	void codec2_encode(unsigned char *bits, const short *speech_in) { m_codec.codec2_encode(bits, speech_in); }
+	bool codec2_get_mode() { return m_codec.codec2_get_mode(); }
+	int  codec2_samples_per_frame() { return m_codec.codec2_samples_per_frame(); }
+	int  codec2_bits_per_frame() { return m_codec.codec2_bits_per_frame(); }
+
+private:
+	CCodec2 m_codec;
+};
+
+class CCodec2Decoder
+{
+public:
+	CCodec2Decoder(bool is_3200) : m_codec(is_3200, false, true) {}
+	void codec2_decode(short *speech_out, const unsigned char *bits) { m_codec.codec2_decode(speech_out, bits); }
+	bool codec2_get_mode() { return m_codec.codec2_get_mode(); }
+	int  codec2_samples_per_frame() { return m_codec.codec2_samples_per_frame(); }
+	int  codec2_bits_per_frame() { return m_codec.codec2_bits_per_frame(); }
+	void set_decode_gain(float g) { m_codec.set_decode_gain(g); }
+	void set_fast_math(bool on) { m_codec.codec2_set_fast_math(on); }
+
+private:
+	CCodec2 m_codec;
+};
+
 #endif
@@ -40,6 +40,8 @@ using CODEC2 = struct codec2_tag {
 	int                lpc_pf;                   /* LPC post filter on                        */
 	int                bass_boost;               /* LPC post filter bass boost                */
 	int                smoothing;                /* enable smoothing for channels with errors */
+	int                fast_math;                /* fastmath.h approximations in the decoder  */
+	unsigned long      rand_next;                /* codec2_rand() state, per instance         */
 	float              ex_phase;                 /* excitation model phase track              */
 	float              bg_est;                   /* background noise estimate for post filter */
 	float              prev_f0_enc;              /* previous frame's f0    estimate           */
@@ -48,20 +50,37 @@ using CODEC2 = struct codec2_tag {
 	float              gamma;
 	float              xq_enc[2];                /* joint pitch and energy VQ states          */
 	float              xq_dec[2];
-	float              W[FFT_ENC];	             /* DFT of w[]                                */
+	const float       *W;	                     /* [FFT_ENC] DFT of w[], shared              */
 	float              hpf_states[2];            /* high pass filter states                   */
 	float              prev_lsps_dec[LPC_ORD];   /* previous frame's LSPs                     */
 	float             *softdec;                  /* optional soft decn bits from demod        */
 	MODEL              prev_model_dec;           /* previous frame's model parameters         */
 	C2CONST            c2const;
-	FFT_STATE          fft_fwd_cfg;              /* forward FFT config                        */
-	FFTR_STATE         fftr_fwd_cfg;             /* forward real FFT config                   */
-	FFTR_STATE         fftr_inv_cfg;             /* inverse FFT config                        */
-	std::vector<float> w;	                     /* [m_pitch] time domain hamming window      */
-	std::vector<float> Pn;	                     /* [2*n_samp] trapezoidal synthesis window   */
+	const FFT_STATE   *fft_fwd_cfg;              /* forward FFT config, shared                */
+	const FFTR_STATE  *fftr_fwd_cfg;             /* forward real FFT config, shared           */
+	const FFTR_STATE  *fftr_inv_cfg;             /* inverse FFT config, shared                */
+	const float       *w;	                     /* [m_pitch] time domain hamming window      */
+	const float       *Pn;	                     /* [2*n_samp] trapezoidal synthesis window   */
 	std::vector<float> Sn;                       /* [m_pitch] input speech                    */
 	std::vector<float> Sn_;	                     /* [2*n_samp] synthesised output speech      */
 	std::vector<float> bpf_buf;                  /* buffer for band pass filter               */
 };
 
+/*
+  The windows and FFT configs only depend on the sample rate and frame
+  length, so they are built once, on first use, and every codec instance
+  points at the same read only copy.
+*/
+
+using CODEC2_TABLES = struct codec2_tables_tag {
+	C2CONST            c2const;
+	FFT_STATE          fft_fwd_cfg;              /* forward FFT, also used by the NLP         */
+	FFTR_STATE         fftr_fwd_cfg;             /* forward real FFT                          */
+	FFTR_STATE         fftr_inv_cfg;             /* inverse real FFT                          */
+	float              W[FFT_ENC];               /* DFT of w[]                                */
+	std::vector<float> w;                        /* [m_pitch] time domain hamming window      */
+	std::vector<float> Pn;                       /* [2*n_samp] trapezoidal synthesis window   */
+	std::vector<float> nlp_w;                    /* NLP DFT window                            */
+};
+
 #endif
@@ -102,7 +102,7 @@ struct lsp_codebook
 	int     k; /* dimension of vector  */
 	int log2m; /* number of bits in m  */
 	int     m; /* elements in codebook */
-	float *cb; /* The elements         */
+	float *cb; /* The elements, k rows of m (structure of arrays), 16 byte aligned */
 };
 
 using FFT_STATE = struct fft_state_tag
@@ -111,12 +111,13 @@ using FFT_STATE = struct fft_state_tag
     bool inverse;
     int  factors[2*MAXFACTORS];
     std::vector<std::complex<float>> twiddles;
+    bool simd;                                        /* use the vectorised power of two path */
+    std::vector<std::complex<float>> stage_twiddles;  /* w^p, w^2p, w^3p for each radix 4 stage */
 };
 
 using FFTR_STATE = struct fftr_state_tag
 {
 	FFT_STATE substate;
-	std::vector<std::complex<float>> tmpbuf;
 	std::vector<std::complex<float>> super_twiddles;
 };
 
@@ -0,0 +1,179 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: fastmath.h
+  DATE CREATED: 2026
+
+  Polynomial approximations of the libm functions called per harmonic by
+  the decoder.  They are enabled by default when built with
+  -DCODEC2_FAST_MATH, otherwise the decoder calls libm as before.
+
+  Worst case errors, checked by M17Bench fastmath:
+
+    fast_sincosf   < 2E-7 absolute for |x| < 1000
+    fast_atan2f    < 5E-6 radians
+    fast_log2f     < 2E-7 relative, or absolute near x = 1
+    fast_exp2f     < 3E-7 relative
+    fast_powf      < 1E-6 relative for the post filter's beta of 0.2
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 by Jonathan Naylor G4KLX
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __FASTMATH__
+#define __FASTMATH__
+
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+
+#if defined(CODEC2_FAST_MATH)
+#define CODEC2_FAST_MATH_DEFAULT true
+#else
+#define CODEC2_FAST_MATH_DEFAULT false
+#endif
+
+/* round to the nearest integer without a libm call, for |x| < 2^22 and not built with -ffast-math */
+static inline float fast_rintf(float x)
+{
+	const float MAGIC = 12582912.0f;	/* 1.5 * 2^23 */
+
+	return (x + MAGIC) - MAGIC;
+}
+
+/* sin and cos together, reduced to [-pi/4, pi/4] and the Cephes sinf/cosf polynomials */
+static inline void fast_sincosf(float x, float *s, float *c)
+{
+	const float TWO_OVER_PI = 0.636619772f;
+	const float PIO2_HI     = 1.5703125f;               /* pi/2 split in three for the reduction */
+	const float PIO2_MID    = 4.837512969970703125E-4f;
+	const float PIO2_LO     = 7.54978995489188216E-8f;
+
+	float q = fast_rintf(x * TWO_OVER_PI);
+	int quadrant = int(q);
+
+	float r  = ((x - q * PIO2_HI) - q * PIO2_MID) - q * PIO2_LO;
+	float r2 = r * r;
+
+	float sr = r + r * r2 * (-1.6666654611E-1f + r2 * (8.3321608736E-3f + r2 * -1.9515295891E-4f));
+	float cr = 1.0f - 0.5f * r2 + r2 * r2 * (4.166664568298827E-2f + r2 * (-1.388731625493765E-3f + r2 * 2.443315711809948E-5f));
+
+	/* odd quadrants swap sin and cos, then the signs follow the quadrant */
+	float sq = (quadrant & 1) ? cr : sr;
+	float cq = (quadrant & 1) ? sr : cr;
+
+	*s = (quadrant & 2) ? -sq : sq;
+	*c = ((quadrant + 1) & 2) ? -cq : cq;
+}
+
+/* atan of the smaller over the larger magnitude as an odd polynomial, then unfolded into the right octant */
+static inline float fast_atan2f(float y, float x)
+{
+	const float PI_F     = 3.14159265f;
+	const float PI_2_F   = 1.57079633f;
+
+	float ax = fabsf(x);
+	float ay = fabsf(y);
+	float mx = ax > ay ? ax : ay;
+	float mn = ax > ay ? ay : ax;
+
+	if (mx == 0.0f)
+		return 0.0f;
+
+	float a  = mn / mx;
+	float a2 = a * a;
+	float r  = a * (0.99997726f + a2 * (-0.33262347f + a2 * (0.19354346f + a2 * (-0.11643287f + a2 * (0.05265332f + a2 * -0.01172120f)))));
+
+	if (ay > ax)
+		r = PI_2_F - r;
+	if (x < 0.0f)
+		r = PI_F - r;
+	if (y < 0.0f)
+		r = -r;
+
+	return r;
+}
+
+/* the exponent from the bits, and log2 of the mantissa scaled to [sqrt(0.5), sqrt(2)) from its atanh series */
+static inline float fast_log2f(float x)
+{
+	uint32_t bits;
+	memcpy(&bits, &x, sizeof(float));
+
+	/* take the exponent relative to sqrt(0.5) so the mantissa lands in the right range without a branch */
+	int32_t e = int32_t(bits - 0x3F3504F3U) >> 23;
+	bits -= uint32_t(e) << 23;
+
+	float m;
+	memcpy(&m, &bits, sizeof(float));
+
+	float t  = (m - 1.0f) / (m + 1.0f);
+	float t2 = t * t;
+
+	return float(e) + t * (2.88539008f + t2 * (0.96179669f + t2 * (0.57707801f + t2 * 0.41219857f)));
+}
+
+/*
+  2^int from the bits, 2^frac for frac in [-0.5, 0.5] from its Taylor series.
+  The exponent is clamped to the normal range for |x| < 2^22.  The clamps
+  and selects here are on integers, as gcc won't if-convert a float select
+  feeding a float to int conversion, and these loops should vectorise.
+*/
+static inline float fast_exp2f(float x)
+{
+	float fi = fast_rintf(x);
+	float f  = x - fi;
+
+	float p = 1.0f + f * (0.693147182f + f * (0.240226507f + f * (0.0555041087f + f * (0.00961812911f + f * (0.00133335581f + f * 0.000154035304f)))));
+
+	int32_t i = int32_t(fi);
+	i = (i < -126) ? -126 : i;
+	i = (i > 127) ? 127 : i;
+
+	uint32_t bits = uint32_t(i + 127) << 23;
+	float scale;
+	memcpy(&scale, &bits, sizeof(float));
+
+	return p * scale;
+}
+
+/* x^y, zero, denormal and negative x give zero */
+static inline float fast_powf(float x, float y)
+{
+	float r = fast_exp2f(y * fast_log2f(x));
+
+	uint32_t xbits, rbits;
+	memcpy(&xbits, &x, sizeof(float));
+	memcpy(&rbits, &r, sizeof(float));
+
+	rbits &= (int32_t(xbits) < 0x00800000) ? 0U : 0xFFFFFFFFU;
+	memcpy(&r, &rbits, sizeof(float));
+
+	return r;
+}
+
+static inline float fast_log10f(float x)
+{
+	return fast_log2f(x) * 0.301029996f;
+}
+
+static inline float fast_exp10f(float x)
+{
+	return fast_exp2f(x * 3.32192809f);
+}
+
+#endif
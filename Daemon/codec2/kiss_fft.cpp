@@ -14,14 +14,174 @@ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
 
 #include <cstring>
 #include <cassert>
+#include <utility>
 
 #include "defines.h"
 #include "kiss_fft.h"
 
-void CKissFFT::kf_bfly2(std::complex<float> *Fout, const size_t fstride, FFT_STATE &st, int m)
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#if defined(__SSE2__) || defined(__ARM_NEON)
+#define KISS_FFT_SIMD
+
+/*
+  Two complex values per vector register, as (re0, im0, re1, im1). These
+  are only used by the power of two path in fft_simd().
+*/
+
+#if defined(__SSE2__)
+using cpx2 = __m128;
+
+static inline cpx2 cpx2_load(const std::complex<float> *p) { return _mm_loadu_ps((const float *)p); }
+static inline void cpx2_store(std::complex<float> *p, cpx2 v) { _mm_storeu_ps((float *)p, v); }
+static inline void cpx2_store_lo(std::complex<float> *p, cpx2 v) { _mm_storel_pi((__m64 *)p, v); }
+static inline void cpx2_store_hi(std::complex<float> *p, cpx2 v) { _mm_storeh_pi((__m64 *)p, v); }
+static inline cpx2 cpx2_dup(const std::complex<float> *p) { return _mm_castpd_ps(_mm_load1_pd((const double *)p)); }
+static inline cpx2 cpx2_add(cpx2 a, cpx2 b) { return _mm_add_ps(a, b); }
+static inline cpx2 cpx2_sub(cpx2 a, cpx2 b) { return _mm_sub_ps(a, b); }
+static inline cpx2 cpx2_swap(cpx2 a) { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)); }
+static inline cpx2 cpx2_neg_re(cpx2 a) { return _mm_xor_ps(a, _mm_castsi128_ps(_mm_set_epi32(0, int(0x80000000), 0, int(0x80000000)))); }
+static inline cpx2 cpx2_neg_im(cpx2 a) { return _mm_xor_ps(a, _mm_castsi128_ps(_mm_set_epi32(int(0x80000000), 0, int(0x80000000), 0))); }
+
+static inline cpx2 cpx2_mul(cpx2 a, cpx2 w)
+{
+	cpx2 wr = _mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 2, 0, 0));
+	cpx2 wi = _mm_shuffle_ps(w, w, _MM_SHUFFLE(3, 3, 1, 1));
+	return _mm_add_ps(_mm_mul_ps(a, wr), cpx2_neg_re(_mm_mul_ps(cpx2_swap(a), wi)));
+}
+#else
+using cpx2 = float32x4_t;
+
+static inline cpx2 cpx2_load(const std::complex<float> *p) { return vld1q_f32((const float *)p); }
+static inline void cpx2_store(std::complex<float> *p, cpx2 v) { vst1q_f32((float *)p, v); }
+static inline void cpx2_store_lo(std::complex<float> *p, cpx2 v) { vst1_f32((float *)p, vget_low_f32(v)); }
+static inline void cpx2_store_hi(std::complex<float> *p, cpx2 v) { vst1_f32((float *)p, vget_high_f32(v)); }
+static inline cpx2 cpx2_dup(const std::complex<float> *p) { float32x2_t w = vld1_f32((const float *)p); return vcombine_f32(w, w); }
+static inline cpx2 cpx2_add(cpx2 a, cpx2 b) { return vaddq_f32(a, b); }
+static inline cpx2 cpx2_sub(cpx2 a, cpx2 b) { return vsubq_f32(a, b); }
+static inline cpx2 cpx2_swap(cpx2 a) { return vrev64q_f32(a); }
+
+static inline cpx2 cpx2_neg_re(cpx2 a)
+{
+	const uint32_t sign[4] = { 0x80000000U, 0U, 0x80000000U, 0U };
+	return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), vld1q_u32(sign)));
+}
+
+static inline cpx2 cpx2_neg_im(cpx2 a)
+{
+	const uint32_t sign[4] = { 0U, 0x80000000U, 0U, 0x80000000U };
+	return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), vld1q_u32(sign)));
+}
+
+static inline cpx2 cpx2_mul(cpx2 a, cpx2 w)
+{
+	float32x4x2_t t = vtrnq_f32(w, w);
+	return vaddq_f32(vmulq_f32(a, t.val[0]), cpx2_neg_re(vmulq_f32(cpx2_swap(a), t.val[1])));
+}
+#endif
+
+/* (b - d) times j for the forward transform, times -j for the inverse */
+static inline cpx2 cpx2_rot(cpx2 a, bool inverse)
+{
+	return inverse ? cpx2_neg_im(cpx2_swap(a)) : cpx2_neg_re(cpx2_swap(a));
+}
+
+/*
+  One radix 4 Stockham stage of length n over s interleaved sub-transforms,
+  x and y must not overlap. The first stage has s == 1 and is vectorised
+  across pairs of butterflies, the later ones across the s sub-transforms.
+*/
+static void stockham_radix4(int n, int s, const std::complex<float> *x, std::complex<float> *y, const std::complex<float> *tw, bool inverse)
+{
+	const int n1 = n / 4;
+	const std::complex<float> *tw1 = tw;
+	const std::complex<float> *tw2 = tw + n1;
+	const std::complex<float> *tw3 = tw + 2 * n1;
+
+	if (s == 1)
+	{
+		for (int p = 0; p < n1; p += 2)
+		{
+			cpx2 a = cpx2_load(x + p);
+			cpx2 b = cpx2_load(x + p + n1);
+			cpx2 c = cpx2_load(x + p + 2 * n1);
+			cpx2 d = cpx2_load(x + p + 3 * n1);
+
+			cpx2 apc  = cpx2_add(a, c);
+			cpx2 amc  = cpx2_sub(a, c);
+			cpx2 bpd  = cpx2_add(b, d);
+			cpx2 jbmd = cpx2_rot(cpx2_sub(b, d), inverse);
+
+			cpx2 y0 = cpx2_add(apc, bpd);
+			cpx2 y1 = cpx2_mul(cpx2_sub(amc, jbmd), cpx2_load(tw1 + p));
+			cpx2 y2 = cpx2_mul(cpx2_sub(apc, bpd),  cpx2_load(tw2 + p));
+			cpx2 y3 = cpx2_mul(cpx2_add(amc, jbmd), cpx2_load(tw3 + p));
+
+			std::complex<float> *out = y + 4 * p;
+			cpx2_store_lo(out + 0, y0);
+			cpx2_store_lo(out + 1, y1);
+			cpx2_store_lo(out + 2, y2);
+			cpx2_store_lo(out + 3, y3);
+			cpx2_store_hi(out + 4, y0);
+			cpx2_store_hi(out + 5, y1);
+			cpx2_store_hi(out + 6, y2);
+			cpx2_store_hi(out + 7, y3);
+		}
+	}
+	else
+	{
+		for (int p = 0; p < n1; p++)
+		{
+			cpx2 w1 = cpx2_dup(tw1 + p);
+			cpx2 w2 = cpx2_dup(tw2 + p);
+			cpx2 w3 = cpx2_dup(tw3 + p);
+
+			const std::complex<float> *in = x + s * p;
+			std::complex<float> *out = y + s * 4 * p;
+
+			for (int q = 0; q < s; q += 2)
+			{
+				cpx2 a = cpx2_load(in + q);
+				cpx2 b = cpx2_load(in + q + s * n1);
+				cpx2 c = cpx2_load(in + q + s * 2 * n1);
+				cpx2 d = cpx2_load(in + q + s * 3 * n1);
+
+				cpx2 apc  = cpx2_add(a, c);
+				cpx2 amc  = cpx2_sub(a, c);
+				cpx2 bpd  = cpx2_add(b, d);
+				cpx2 jbmd = cpx2_rot(cpx2_sub(b, d), inverse);
+
+				cpx2_store(out + q,         cpx2_add(apc, bpd));
+				cpx2_store(out + q + s,     cpx2_mul(cpx2_sub(amc, jbmd), w1));
+				cpx2_store(out + q + s * 2, cpx2_mul(cpx2_sub(apc, bpd),  w2));
+				cpx2_store(out + q + s * 3, cpx2_mul(cpx2_add(amc, jbmd), w3));
+			}
+		}
+	}
+}
+
+/* The closing radix 2 stage when log2(nfft) is odd, no twiddles are needed */
+static void stockham_radix2(int s, const std::complex<float> *x, std::complex<float> *y)
+{
+	for (int q = 0; q < s; q += 2)
+	{
+		cpx2 a = cpx2_load(x + q);
+		cpx2 b = cpx2_load(x + q + s);
+
+		cpx2_store(y + q,     cpx2_add(a, b));
+		cpx2_store(y + q + s, cpx2_sub(a, b));
+	}
+}
+#endif
+
+void CKissFFT::kf_bfly2(std::complex<float> *Fout, const size_t fstride, const FFT_STATE &st, int m)
 {
 	std::complex<float> *Fout2;
-	std::complex<float> *tw1 = st.twiddles.data();
+	const std::complex<float> *tw1 = st.twiddles.data();
 	std::complex<float> t;
 	Fout2 = Fout + m;
 	do
@@ -36,10 +196,10 @@ void CKissFFT::kf_bfly2(std::complex<float> *Fout, const size_t fstride, FFT_STA
 	while (--m);
 }
 
-void CKissFFT::kf_bfly3(std::complex<float> * Fout, const size_t fstride, FFT_STATE &st, int m)
+void CKissFFT::kf_bfly3(std::complex<float> * Fout, const size_t fstride, const FFT_STATE &st, int m)
 {
 	const size_t m2 = 2 * m;
-	std::complex<float> *tw1,*tw2;
+	const std::complex<float> *tw1,*tw2;
 	std::complex<float> scratch[5];
 	std::complex<float> epi3;
 	epi3 = st.twiddles[fstride*m];
@@ -73,9 +233,9 @@ void CKissFFT::kf_bfly3(std::complex<float> * Fout, const size_t fstride, FFT_ST
 	while(--m);
 }
 
-void CKissFFT::kf_bfly4(std::complex<float> *Fout, const size_t fstride, FFT_STATE &st, int m)
+void CKissFFT::kf_bfly4(std::complex<float> *Fout, const size_t fstride, const FFT_STATE &st, int m)
 {
-	std::complex<float> *tw1,*tw2,*tw3;
+	const std::complex<float> *tw1,*tw2,*tw3;
 	std::complex<float> scratch[6];
 	int k = m;
 	const int m2 = 2 * m;
@@ -119,10 +279,10 @@ void CKissFFT::kf_bfly4(std::complex<float> *Fout, const size_t fstride, FFT_STA
 	while(--k);
 }
 
-void CKissFFT::kf_bfly5(std::complex<float> * Fout, const size_t fstride, FFT_STATE &st, int m)
+void CKissFFT::kf_bfly5(std::complex<float> * Fout, const size_t fstride, const FFT_STATE &st, int m)
 {
 	std::complex<float> scratch[13];
-	std::complex<float> *twiddles = st.twiddles.data();
+	const std::complex<float> *twiddles = st.twiddles.data();
 	auto ya = twiddles[fstride*m];
 	auto yb = twiddles[fstride*2*m];
 
@@ -173,7 +333,7 @@ void CKissFFT::kf_bfly5(std::complex<float> * Fout, const size_t fstride, FFT_ST
 }
 
 /* perform the butterfly for one stage of a mixed radix FFT */
-void CKissFFT::kf_bfly_generic(std::complex<float> *Fout, const size_t fstride, FFT_STATE &st, int m, int p)
+void CKissFFT::kf_bfly_generic(std::complex<float> *Fout, const size_t fstride, const FFT_STATE &st, int m, int p)
 {
 	auto twiddles = st.twiddles.data();
 	std::complex<float> t;
@@ -208,7 +368,7 @@ void CKissFFT::kf_bfly_generic(std::complex<float> *Fout, const size_t fstride,
 	scratch.clear();
 }
 
-void CKissFFT::kf_work(std::complex<float> *Fout, const std::complex<float> *f, const size_t fstride, int in_stride, int *factors, FFT_STATE &st)
+void CKissFFT::kf_work(std::complex<float> *Fout, const std::complex<float> *f, const size_t fstride, int in_stride, const int *factors, const FFT_STATE &st)
 {
 	auto Fout_beg = Fout;
 	const int p = *factors++; /* the radix  */
@@ -298,7 +458,7 @@ void CKissFFT::kf_factor(int n,int * facbuf)
 	while (n > 1);
 }
 
-void CKissFFT::fft_alloc(FFT_STATE &state, const int nfft, bool inverse_fft)
+void CKissFFT::fft_alloc(FFT_STATE &state, const int nfft, bool inverse_fft, bool simd)
 {
 	state.twiddles.resize(nfft);
 
@@ -315,10 +475,34 @@ void CKissFFT::fft_alloc(FFT_STATE &state, const int nfft, bool inverse_fft)
 	}
 
 	kf_factor(nfft, state.factors);
+
+	/* powers of two from 8 up to the stack buffer size can use the vectorised path */
+	state.simd = false;
+	state.stage_twiddles.clear();
+
+#if defined(KISS_FFT_SIMD)
+	if (simd && nfft >= 8 && nfft <= KISS_FFT_STACK_SIZE && (nfft & (nfft - 1)) == 0)
+	{
+		state.simd = true;
+
+		/* the twiddles for each radix 4 stage, w^k for a stage of length n is twiddles[k*nfft/n] */
+		for (int n = nfft; n >= 4; n /= 4)
+		{
+			int stride = nfft / n;
+			for (int k = 1; k <= 3; k++)
+			{
+				for (int p = 0; p < n / 4; p++)
+					state.stage_twiddles.push_back(state.twiddles[k * p * stride]);
+			}
+		}
+	}
+#else
+	(void)simd;
+#endif
 }
 
 
-void CKissFFT::fft_stride(FFT_STATE &st, const std::complex<float> *fin, std::complex<float> *fout, int in_stride)
+void CKissFFT::fft_stride(const FFT_STATE &st, const std::complex<float> *fin, std::complex<float> *fout, int in_stride)
 {
 	if (fin == fout)
 	{
@@ -335,11 +519,69 @@ void CKissFFT::fft_stride(FFT_STATE &st, const std::complex<float> *fin, std::co
 	}
 }
 
-void CKissFFT::fft(FFT_STATE &cfg, const std::complex<float> *fin, std::complex<float> *fout)
+void CKissFFT::fft(const FFT_STATE &cfg, const std::complex<float> *fin, std::complex<float> *fout)
 {
+#if defined(KISS_FFT_SIMD)
+	if (cfg.simd)
+	{
+		fft_simd(cfg, fin, fout);
+		return;
+	}
+#endif
 	fft_stride(cfg, fin, fout, 1);
 }
 
+/*
+  Stockham autosort FFT for power of two sizes: radix 4 stages with a final
+  radix 2 stage when needed, ping-ponging between fout and a stack buffer
+  and producing the output in natural order. The results match kf_work() to
+  within float rounding.
+*/
+void CKissFFT::fft_simd(const FFT_STATE &st, const std::complex<float> *fin, std::complex<float> *fout)
+{
+#if defined(KISS_FFT_SIMD)
+	alignas(16) float buffer[2*KISS_FFT_STACK_SIZE];
+	std::complex<float> *scratch = (std::complex<float> *)buffer;
+
+	int stages = 0;
+	for (int n = st.nfft; n > 1; n /= 4)
+		stages++;
+
+	/* arrange for the last stage to write into fout */
+	std::complex<float> *dst   = (stages % 2) ? fout : scratch;
+	std::complex<float> *other = (stages % 2) ? scratch : fout;
+
+	const std::complex<float> *src = fin;
+	if (fin == fout && dst == fout)
+	{
+		memcpy(scratch, fin, sizeof(std::complex<float>)*st.nfft);
+		src = scratch;
+	}
+
+	const std::complex<float> *tw = st.stage_twiddles.data();
+	int s = 1;
+
+	for (int n = st.nfft; n > 1; n /= 4)
+	{
+		if (n == 2)
+		{
+			stockham_radix2(s, src, dst);
+		}
+		else
+		{
+			stockham_radix4(n, s, src, dst, tw, st.inverse);
+			tw += 3 * (n / 4);
+		}
+
+		s *= 4;
+		src = dst;
+		std::swap(dst, other);
+	}
+#else
+	fft_stride(st, fin, fout, 1);
+#endif
+}
+
 int CKissFFT::fft_next_fast_size(int n)
 {
 	while(1)
@@ -355,12 +597,11 @@ int CKissFFT::fft_next_fast_size(int n)
 	return n;
 }
 
-void CKissFFT::fftr_alloc(FFTR_STATE &st, int nfft, const bool inverse_fft)
+void CKissFFT::fftr_alloc(FFTR_STATE &st, int nfft, const bool inverse_fft, const bool simd)
 {
 	nfft >>= 1;
 
-	fft_alloc(st.substate, nfft, inverse_fft);
-	st.tmpbuf.resize(nfft);
+	fft_alloc(st.substate, nfft, inverse_fft, simd);
 	st.super_twiddles.resize(nfft);
 
 	for (int i=0; i<nfft/2; ++i)
@@ -372,14 +613,23 @@ void CKissFFT::fftr_alloc(FFTR_STATE &st, int nfft, const bool inverse_fft)
 	}
 }
 
-void CKissFFT::fftr(FFTR_STATE &st, const float *timedata, std::complex<float> *freqdata)
+void CKissFFT::fftr(const FFTR_STATE &st, const float *timedata, std::complex<float> *freqdata)
 {
 	assert(st.substate.inverse == false);
 
 	auto ncfft = st.substate.nfft;
 
+	alignas(16) float buffer[2*KISS_FFT_STACK_SIZE];
+	std::vector<std::complex<float>> heap;
+	std::complex<float> *tmpbuf = (std::complex<float> *)buffer;
+	if (ncfft > KISS_FFT_STACK_SIZE)
+	{
+		heap.resize(ncfft);
+		tmpbuf = heap.data();
+	}
+
 	/*perform the parallel fft of two real signals packed in real,imag*/
-	fft( st.substate, (const std::complex<float>*)timedata, st.tmpbuf.data());
+	fft( st.substate, (const std::complex<float>*)timedata, tmpbuf);
 	/* The real part of the DC element of the frequency spectrum in st->tmpbuf
 	 * contains the sum of the even-numbered elements of the input time sequence
 	 * The imag part is the sum of the odd-numbered elements
@@ -390,7 +640,7 @@ void CKissFFT::fftr(FFTR_STATE &st, const float *timedata, std::complex<float> *
 	 *      yielding Nyquist bin of input time sequence
 	 */
 
-	auto tdc = st.tmpbuf[0];
+	auto tdc = tmpbuf[0];
 	freqdata[0].real(tdc.real() + tdc.imag());
 	freqdata[ncfft].real(tdc.real() - tdc.imag());
 	freqdata[ncfft].imag(0.f);
@@ -398,8 +648,8 @@ void CKissFFT::fftr(FFTR_STATE &st, const float *timedata, std::complex<float> *
 
 	for (int  k=1; k <= ncfft/2; ++k)
 	{
-		auto fpk = st.tmpbuf[k];
-		auto fpnk = std::conj(st.tmpbuf[ncfft-k]);
+		auto fpk = tmpbuf[k];
+		auto fpnk = std::conj(tmpbuf[ncfft-k]);
 
 		auto f1k = fpk + fpnk;
 		auto f2k = fpk - fpnk;
@@ -411,14 +661,23 @@ void CKissFFT::fftr(FFTR_STATE &st, const float *timedata, std::complex<float> *
 	}
 }
 
-void CKissFFT::fftri(FFTR_STATE &st, const std::complex<float> *freqdata, float *timedata)
+void CKissFFT::fftri(const FFTR_STATE &st, const std::complex<float> *freqdata, float *timedata)
 {
 	assert(st.substate.inverse == true);
 
 	auto ncfft = st.substate.nfft;
 
-	st.tmpbuf[0].real(freqdata[0].real() + freqdata[ncfft].real());
-	st.tmpbuf[0].imag(freqdata[0].real() - freqdata[ncfft].real());
+	alignas(16) float buffer[2*KISS_FFT_STACK_SIZE];
+	std::vector<std::complex<float>> heap;
+	std::complex<float> *tmpbuf = (std::complex<float> *)buffer;
+	if (ncfft > KISS_FFT_STACK_SIZE)
+	{
+		heap.resize(ncfft);
+		tmpbuf = heap.data();
+	}
+
+	tmpbuf[0].real(freqdata[0].real() + freqdata[ncfft].real());
+	tmpbuf[0].imag(freqdata[0].real() - freqdata[ncfft].real());
 
 	for (int k=1; k <= ncfft/2; ++k)
 	{
@@ -428,8 +687,8 @@ void CKissFFT::fftri(FFTR_STATE &st, const std::complex<float> *freqdata, float
 		auto fek = fk + fnkc;
 		auto tmp = fk - fnkc;
 		auto fok = tmp * st.super_twiddles[k-1];
-		st.tmpbuf[k] = fek + fok;
-		st.tmpbuf[ncfft - k] = std::conj(fek - fok);
+		tmpbuf[k] = fek + fok;
+		tmpbuf[ncfft - k] = std::conj(fek - fok);
 	}
-	fft (st.substate, st.tmpbuf.data(), (std::complex<float> *)timedata);
+	fft (st.substate, tmpbuf, (std::complex<float> *)timedata);
 }
@@ -146,15 +146,42 @@ static const float fdmdv_os_filter[]= {
     -0.0008215855034550383
 };
 
+/*---------------------------------------------------------------------------*\
+
+  nlp_make_window()
+
+  Generates the DFT window for the NLP pitch estimator.  It only depends
+  on the sample rate, so one copy is shared by every instance.
+
+\*---------------------------------------------------------------------------*/
+
+void Cnlp::nlp_make_window(C2CONST *c2const, float w[])
+{
+	int  i;
+	int  m = c2const->m_pitch;
+
+	if (c2const->Fs == 16000)
+		m /= 2;
+
+	assert(m <= PMAX_M);
+
+	for(i=0; i<m/DEC; i++)
+	{
+		w[i] = 0.5 - 0.5*cosf(2*PI*i/(m/DEC-1));
+	}
+}
+
 /*---------------------------------------------------------------------------*\
 
   nlp_create()
 
-  Initialisation function for NLP pitch estimator.
+  Initialisation function for NLP pitch estimator.  The window from
+  nlp_make_window() and the PE_FFT_SIZE point FFT config are shared
+  and read only.
 
 \*---------------------------------------------------------------------------*/
 
-void Cnlp::nlp_create(C2CONST *c2const)
+void Cnlp::nlp_create(C2CONST *c2const, const float w[], const FFT_STATE *fft_cfg)
 {
 	int  i;
 	int  m = c2const->m_pitch;
@@ -181,11 +208,10 @@ void Cnlp::nlp_create(C2CONST *c2const)
 	}
 
 	assert(m <= PMAX_M);
+	assert(fft_cfg->nfft == PE_FFT_SIZE && !fft_cfg->inverse);
 
-	for(i=0; i<m/DEC; i++)
-	{
-		snlp.w[i] = 0.5 - 0.5*cosf(2*PI*i/(m/DEC-1));
-	}
+	snlp.w = w;
+	snlp.fft_cfg = fft_cfg;
 
 	for(i=0; i<PMAX_M; i++)
 		snlp.sq[i] = 0.0;
@@ -193,8 +219,6 @@ void Cnlp::nlp_create(C2CONST *c2const)
 	snlp.mem_y = 0.0;
 	for(i=0; i<NLP_NTAP; i++)
 		snlp.mem_fir[i] = 0.0;
-
-	kiss.fft_alloc(snlp.fft_cfg, PE_FFT_SIZE, false);
 }
 
 /*---------------------------------------------------------------------------*\
@@ -207,7 +231,8 @@ void Cnlp::nlp_create(C2CONST *c2const)
 
 void Cnlp::nlp_destroy()
 {
-	snlp.fft_cfg.twiddles.clear();
+	snlp.w = NULL;
+	snlp.fft_cfg = NULL;
 }
 
 /*---------------------------------------------------------------------------*\
@@ -341,7 +366,7 @@ float Cnlp::nlp(
 
 	// FIXME: check if this can be converted to a real fft
 	// since all imag inputs are 0
-	codec2_fft_inplace(snlp.fft_cfg, Fw);
+	codec2_fft_inplace(*snlp.fft_cfg, Fw);
 
 	for(i=0; i<PE_FFT_SIZE; i++)
 		Fw[i].real(Fw[i].real() * Fw[i].real() + Fw[i].imag() * Fw[i].imag());
@@ -501,7 +526,7 @@ void Cnlp::fdmdv_16_to_8(float out8k[], float in16k[], int n)
 // not noticeable
 // the reduced usage of RAM and increased performance on STM32 platforms
 // should be worth it.
-void Cnlp::codec2_fft_inplace(FFT_STATE &cfg, std::complex<float> *inout)
+void Cnlp::codec2_fft_inplace(const FFT_STATE &cfg, std::complex<float> *inout)
 {
 	std::complex<float> in[512];
 	// decide whether to use the local stack based buffer for in
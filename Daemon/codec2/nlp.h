@@ -61,21 +61,22 @@ using NLP = struct nlp_tag
 {
 	int           Fs;                /* sample rate in Hz            */
 	int           m;
-	float         w[PMAX_M/DEC];     /* DFT window                   */
+	const float  *w;                 /* DFT window, shared           */
 	float         sq[PMAX_M];	     /* squared speech samples       */
 	float         mem_x,mem_y;       /* memory for notch filter      */
 	float         mem_fir[NLP_NTAP]; /* decimation FIR filter memory */
-	FFT_STATE     fft_cfg;           /* kiss FFT config              */
+	const FFT_STATE *fft_cfg;        /* kiss FFT config, shared      */
 	std::vector<float> Sn16k;	     /* Fs=16kHz input speech vector */
 };
 
 
 class Cnlp {
 public:
-	void nlp_create(C2CONST *c2const);
+	static void nlp_make_window(C2CONST *c2const, float w[]);
+	void nlp_create(C2CONST *c2const, const float w[], const FFT_STATE *fft_cfg);
 	void nlp_destroy();
 	float nlp(float Sn[], int n, float *pitch_samples, float *prev_f0);
-	void codec2_fft_inplace(FFT_STATE &cfg, std::complex<float> *inout);
+	void codec2_fft_inplace(const FFT_STATE &cfg, std::complex<float> *inout);
 
 private:
 	float post_process_sub_multiples(std::complex<float> Fw[], int pmax, float gmax, int gmax_bin, float *prev_f0);
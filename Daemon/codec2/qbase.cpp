@@ -1,8 +1,101 @@
 #include <assert.h>
 #include <math.h>
+#include <stdint.h>
 
 #include "qbase.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+/*---------------------------------------------------------------------------*\
+
+  The codebooks are stored as structure of arrays, row i holding element
+  i of every vector, so the searches below measure the distance to four
+  entries at once.  Each lane sums its terms in the same order as the
+  scalar code did, the distances are bit for bit the same and the index
+  chosen, the first one with the smallest distance, is unchanged.
+
+\*---------------------------------------------------------------------------*/
+
+#if defined(__SSE2__)
+using dist4  = __m128;
+using index4 = __m128i;
+
+static inline index4 index4_first() { return _mm_set_epi32(3, 2, 1, 0); }
+static inline index4 index4_next(index4 v) { return _mm_add_epi32(v, _mm_set1_epi32(4)); }
+
+static inline dist4 dist4_load(const float *p) { return _mm_loadu_ps(p); }
+static inline dist4 dist4_dup(float x) { return _mm_set1_ps(x); }
+static inline dist4 dist4_add(dist4 a, dist4 b) { return _mm_add_ps(a, b); }
+static inline dist4 dist4_sub(dist4 a, dist4 b) { return _mm_sub_ps(a, b); }
+static inline dist4 dist4_mul(dist4 a, dist4 b) { return _mm_mul_ps(a, b); }
+
+/* keep the smaller distance, and its index, in each lane */
+static inline void dist4_min(dist4 e, index4 idx, dist4 &best, index4 &besti)
+{
+	__m128i mask = _mm_castps_si128(_mm_cmplt_ps(e, best));
+	best  = _mm_min_ps(e, best);
+	besti = _mm_or_si128(_mm_and_si128(mask, idx), _mm_andnot_si128(mask, besti));
+}
+
+/* the first index with the smallest distance across the lanes */
+static inline void dist4_reduce(dist4 best, index4 besti, float &beste, long &bestj)
+{
+	float e[4];
+	int32_t j[4];
+	_mm_storeu_ps(e, best);
+	_mm_storeu_si128((__m128i *)j, besti);
+
+	for (int l=0; l<4; l++)
+	{
+		if (e[l] < beste || (e[l] == beste && j[l] < bestj))
+		{
+			beste = e[l];
+			bestj = j[l];
+		}
+	}
+}
+#elif defined(__ARM_NEON)
+using dist4  = float32x4_t;
+using index4 = int32x4_t;
+
+static inline index4 index4_first() { const int32_t lanes[4] = { 0, 1, 2, 3 }; return vld1q_s32(lanes); }
+static inline index4 index4_next(index4 v) { return vaddq_s32(v, vdupq_n_s32(4)); }
+
+static inline dist4 dist4_load(const float *p) { return vld1q_f32(p); }
+static inline dist4 dist4_dup(float x) { return vdupq_n_f32(x); }
+static inline dist4 dist4_add(dist4 a, dist4 b) { return vaddq_f32(a, b); }
+static inline dist4 dist4_sub(dist4 a, dist4 b) { return vsubq_f32(a, b); }
+static inline dist4 dist4_mul(dist4 a, dist4 b) { return vmulq_f32(a, b); }
+
+static inline void dist4_min(dist4 e, index4 idx, dist4 &best, index4 &besti)
+{
+	uint32x4_t mask = vcltq_f32(e, best);
+	best  = vbslq_f32(mask, e, best);
+	besti = vbslq_s32(mask, idx, besti);
+}
+
+static inline void dist4_reduce(dist4 best, index4 besti, float &beste, long &bestj)
+{
+	float e[4];
+	int32_t j[4];
+	vst1q_f32(e, best);
+	vst1q_s32(j, besti);
+
+	for (int l=0; l<4; l++)
+	{
+		if (e[l] < beste || (e[l] == beste && j[l] < bestj))
+		{
+			beste = e[l];
+			bestj = j[l];
+		}
+	}
+}
+#endif
+
 /*---------------------------------------------------------------------------*\
 
   quantise
@@ -14,7 +107,7 @@
 \*---------------------------------------------------------------------------*/
 
 long CQbase::quantise(const float *cb, float vec[], float w[], int k, int m, float *se)
-/* float   cb[][K];	current VQ codebook       */
+/* float   cb[K][M];	current VQ codebook       */
 /* float   vec[];	vector to quantise        */
 /* float   w[];     weighting vector          */
 /* int	   k;		dimension of vectors      */
@@ -30,12 +123,38 @@ long CQbase::quantise(const float *cb, float vec[], float w[], int k, int m, flo
 
 	besti = 0;
 	beste = 1E32;
-	for(j=0; j<m; j++)
+	j = 0;
+
+#if defined(__SSE2__) || defined(__ARM_NEON)
+	if (m >= 4)
+	{
+		dist4  best  = dist4_dup(1E32);
+		index4 bestj = index4_first();
+		index4 idx   = index4_first();
+
+		for(; j+4<=m; j+=4)
+		{
+			dist4 e4 = dist4_dup(0.0);
+			for(i=0; i<k; i++)
+			{
+				dist4 wi = dist4_dup(w[i]);
+				dist4 d4 = dist4_sub(dist4_load(&cb[i*m+j]), dist4_dup(vec[i]));
+				e4 = dist4_add(e4, dist4_mul(dist4_mul(dist4_mul(d4, wi), d4), wi));
+			}
+			dist4_min(e4, idx, best, bestj);
+			idx = index4_next(idx);
+		}
+
+		dist4_reduce(best, bestj, beste, besti);
+	}
+#endif
+
+	for(; j<m; j++)
 	{
 		e = 0.0;
 		for(i=0; i<k; i++)
 		{
-			diff = cb[j*k+i]-vec[i];
+			diff = cb[i*m+j]-vec[i];
 			e += (diff*w[i] * diff*w[i]);
 		}
 		if (e < beste)
@@ -85,8 +204,8 @@ int CQbase::encode_WoE(MODEL *model, float e, float xq[])
 
 	for (i=0; i<ndim; i++)
 	{
-		xq[i] = ge_coeff[i]*xq[i] + codebook1[ndim*n1+i];
-		err[i] -= codebook1[ndim*n1+i];
+		xq[i] = ge_coeff[i]*xq[i] + codebook1[i*nb_entries+n1];
+		err[i] -= codebook1[i*nb_entries+n1];
 	}
 
 	//printf("enc: %f %f (%f)(%f) \n", xq[0], xq[1], e, 10.0*log10(1e-4 + e));
@@ -110,13 +229,14 @@ void CQbase::decode_WoE(C2CONST *c2const, MODEL *model, float *e, float xq[], in
 {
 	int          i;
 	const float *codebook1 = ge_cb[0].cb;
+	int          nb_entries = ge_cb[0].m;
 	int          ndim = ge_cb[0].k;
 	float Wo_min = c2const->Wo_min;
 	float Wo_max = c2const->Wo_max;
 
 	for (i=0; i<ndim; i++)
 	{
-		xq[i] = ge_coeff[i]*xq[i] + codebook1[ndim*n1+i];
+		xq[i] = ge_coeff[i]*xq[i] + codebook1[i*nb_entries+n1];
 	}
 
 	//printf("dec: %f %f\n", xq[0], xq[1]);
@@ -181,13 +301,38 @@ int CQbase::find_nearest_weighted(const float *codebook, int nb_entries, float *
 {
 	int i, j;
 	float min_dist = 1e15;
-	int nearest = 0;
+	long nearest = 0;
+
+	i = 0;
+
+#if defined(__SSE2__) || defined(__ARM_NEON)
+	if (nb_entries >= 4)
+	{
+		dist4  best  = dist4_dup(1e15);
+		index4 besti = index4_first();
+		index4 idx   = index4_first();
+
+		for (; i+4<=nb_entries; i+=4)
+		{
+			dist4 dist = dist4_dup(0);
+			for (j=0; j<ndim; j++)
+			{
+				dist4 d = dist4_sub(dist4_dup(x[j]), dist4_load(&codebook[j*nb_entries+i]));
+				dist = dist4_add(dist, dist4_mul(dist4_mul(dist4_dup(w[j]), d), d));
+			}
+			dist4_min(dist, idx, best, besti);
+			idx = index4_next(idx);
+		}
+
+		dist4_reduce(best, besti, min_dist, nearest);
+	}
+#endif
 
-	for (i=0; i<nb_entries; i++)
+	for (; i<nb_entries; i++)
 	{
 		float dist=0;
 		for (j=0; j<ndim; j++)
-			dist += w[j]*(x[j]-codebook[i*ndim+j])*(x[j]-codebook[i*ndim+j]);
+			dist += w[j]*(x[j]-codebook[j*nb_entries+i])*(x[j]-codebook[j*nb_entries+i]);
 		if (dist<min_dist)
 		{
 			min_dist = dist;
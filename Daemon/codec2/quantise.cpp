@@ -35,6 +35,7 @@
 #include "quantise.h"
 #include "lpc.h"
 #include "kiss_fft.h"
+#include "fastmath.h"
 
 extern CKissFFT kiss;
 
@@ -103,7 +104,7 @@ void CQuantize::encode_lspds_scalar(int indexes[], float lsp[], int order)
 		m = lsp_cbd[i].m;
 		cb = lsp_cbd[i].cb;
 		indexes[i] = quantise(cb, &dlsp[i], wt, k, m, &se);
-		dlsp_[i] = cb[indexes[i]*k];
+		dlsp_[i] = cb[indexes[i]];
 
 
 		if (i)
@@ -117,7 +118,7 @@ void CQuantize::encode_lspds_scalar(int indexes[], float lsp[], int order)
 
 void CQuantize::decode_lspds_scalar( float lsp_[], int indexes[], int   order)
 {
-	int   i,k;
+	int   i;
 	float lsp__hz[order];
 	float dlsp_[order];
 	const float *cb;
@@ -125,9 +126,8 @@ void CQuantize::decode_lspds_scalar( float lsp_[], int indexes[], int   order)
 	for(i=0; i<order; i++)
 	{
 
-		k = lsp_cbd[i].k;
 		cb = lsp_cbd[i].cb;
-		dlsp_[i] = cb[indexes[i]*k];
+		dlsp_[i] = cb[indexes[i]];
 
 		if (i)
 			lsp__hz[i] = lsp__hz[i-1] + dlsp_[i];
@@ -164,7 +164,7 @@ int CQuantize::find_nearest(const float *codebook, int nb_entries, float *x, int
 	{
 		float dist=0;
 		for (j=0; j<ndim; j++)
-			dist += (x[j]-codebook[i*ndim+j])*(x[j]-codebook[i*ndim+j]);
+			dist += (x[j]-codebook[j*nb_entries+i])*(x[j]-codebook[j*nb_entries+i]);
 		if (dist<min_dist)
 		{
 			min_dist = dist;
@@ -224,7 +224,7 @@ int CQuantize::check_lsp_order(float lsp[], int order)
 
 \*---------------------------------------------------------------------------*/
 
-void CQuantize::lpc_post_filter(FFTR_STATE *fftr_fwd_cfg, float Pw[], float ak[], int order, float beta, float gamma, int bass_boost, float E)
+void CQuantize::lpc_post_filter(const FFTR_STATE *fftr_fwd_cfg, float Pw[], float ak[], int order, float beta, float gamma, int bass_boost, float E, int fast_math)
 {
 	int   i;
 	float x[FFT_ENC];   /* input to FFTs                */
@@ -260,14 +260,17 @@ void CQuantize::lpc_post_filter(FFTR_STATE *fftr_fwd_cfg, float Pw[], float ak[]
 
 	max_Rw = 0.0;
 	min_Rw = 1E32;
-	for(i=0; i<FFT_ENC/2; i++)
+	if (!fast_math)
 	{
-		Rw[i] = sqrtf(Ww[i].real() * Pw[i]);
-		if (Rw[i] > max_Rw)
-			max_Rw = Rw[i];
-		if (Rw[i] < min_Rw)
-			min_Rw = Rw[i];
+		for(i=0; i<FFT_ENC/2; i++)
+		{
+			Rw[i] = sqrtf(Ww[i].real() * Pw[i]);
+			if (Rw[i] > max_Rw)
+				max_Rw = Rw[i];
+			if (Rw[i] < min_Rw)
+				min_Rw = Rw[i];
 
+		}
 	}
 
 	/* create post filter mag spectrum and apply ------------------*/
@@ -281,13 +284,25 @@ void CQuantize::lpc_post_filter(FFTR_STATE *fftr_fwd_cfg, float Pw[], float ak[]
 	/* apply post filter and measure energy  */
 
 
+	if (fast_math)
+	{
+		/* (R^beta)^2 = (WP)^beta, so no square root, and no sum in the
+		   loop so that it vectorises */
+		for(i=0; i<FFT_ENC/2; i++)
+			Pw[i] *= fast_powf(Ww[i].real() * Pw[i], beta);
+	}
+	else
+	{
+		for(i=0; i<FFT_ENC/2; i++)
+		{
+			Pfw = powf(Rw[i], beta);
+			Pw[i] *= Pfw * Pfw;
+		}
+	}
+
 	e_after = 1E-4;
 	for(i=0; i<FFT_ENC/2; i++)
-	{
-		Pfw = powf(Rw[i], beta);
-		Pw[i] *= Pfw * Pfw;
 		e_after += Pw[i];
-	}
 	gain = e_before/e_after;
 
 	/* apply gain factor to normalise energy, and LPC Energy */
@@ -321,7 +336,7 @@ void CQuantize::lpc_post_filter(FFTR_STATE *fftr_fwd_cfg, float Pw[], float ak[]
 \*---------------------------------------------------------------------------*/
 
 void CQuantize::aks_to_M2(
-	FFTR_STATE * fftr_fwd_cfg,
+	const FFTR_STATE * fftr_fwd_cfg,
 	float         ak[],	     /* LPC's */
 	int           order,
 	MODEL        *model,	   /* sinusoidal model parameters for this frame */
@@ -332,6 +347,7 @@ void CQuantize::aks_to_M2(
 	int           bass_boost,  /* enable LPC filter 0-1kHz 3dB boost */
 	float         beta,
 	float         gamma,       /* LPC post filter parameters */
+	int           fast_math,   /* true to use the fastmath.h powf in the post filter */
 	std::complex<float>          Aw[]         /* output power spectrum */
 )
 {
@@ -368,7 +384,7 @@ void CQuantize::aks_to_M2(
 	}
 
 	if (pf)
-		lpc_post_filter(fftr_fwd_cfg, Pw, ak, order, beta, gamma, bass_boost, E);
+		lpc_post_filter(fftr_fwd_cfg, Pw, ak, order, beta, gamma, bass_boost, E, fast_math);
 	else
 	{
 		for(i=0; i<FFT_ENC/2; i++)
@@ -489,7 +505,7 @@ float CQuantize::decode_Wo(C2CONST *c2const, int index, int bits)
 
 \*---------------------------------------------------------------------------*/
 
-float CQuantize::speech_to_uq_lsps(float lsp[], float ak[], float Sn[], float w[], int m_pitch, int order)
+float CQuantize::speech_to_uq_lsps(float lsp[], float ak[], float Sn[], const float w[], int m_pitch, int order)
 {
 	int   i, roots;
 	float Wn[m_pitch];
@@ -589,15 +605,14 @@ void CQuantize::encode_lsps_scalar(int indexes[], float lsp[], int order)
 
 void CQuantize::decode_lsps_scalar(float lsp[], int indexes[], int order)
 {
-	int    i,k;
+	int    i;
 	float  lsp_hz[order];
 	const float *cb;
 
 	for(i=0; i<order; i++)
 	{
-		k = lsp_cb[i].k;
 		cb = lsp_cb[i].cb;
-		lsp_hz[i] = cb[indexes[i]*k];
+		lsp_hz[i] = cb[indexes[i]];
 	}
 
 	/* convert back to radians */
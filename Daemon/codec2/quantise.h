@@ -32,7 +32,7 @@
 
 class CQuantize : public CQbase {
 public:
-	void aks_to_M2(FFTR_STATE *fftr_fwd_cfg, float ak[], int order, MODEL *model, float E, float *snr, int sim_pf, int pf, int bass_boost, float beta, float gamma, std::complex<float> Aw[]);
+	void aks_to_M2(const FFTR_STATE *fftr_fwd_cfg, float ak[], int order, MODEL *model, float E, float *snr, int sim_pf, int pf, int bass_boost, float beta, float gamma, int fast_math, std::complex<float> Aw[]);
 
 	int   encode_Wo(C2CONST *c2const, float Wo, int bits);
 	float decode_Wo(C2CONST *c2const, int index, int bits);
@@ -53,14 +53,14 @@ public:
 	int lspd_bits(int i);
 
 	void apply_lpc_correction(MODEL *model);
-	float speech_to_uq_lsps(float lsp[], float ak[], float Sn[], float w[], int m_pitch, int order);
+	float speech_to_uq_lsps(float lsp[], float ak[], float Sn[], const float w[], int m_pitch, int order);
 	int check_lsp_order(float lsp[], int lpc_order);
 	void bw_expand_lsps(float lsp[], int order, float min_sep_low, float min_sep_high);
 
 private:
 	void compute_weights(const float *x, float *w, int ndim);
 	int find_nearest(const float *codebook, int nb_entries, float *x, int ndim);
-	void lpc_post_filter(FFTR_STATE *fftr_fwd_cfg, float Pw[], float ak[], int order, float beta, float gamma, int bass_boost, float E);
+	void lpc_post_filter(const FFTR_STATE *fftr_fwd_cfg, float Pw[], float ak[], int order, float beta, float gamma, int bass_boost, float E, int fast_math);
 	int lpc_to_lsp (float *a, int lpcrdr, float *freq, int nb, float delta);
 	float cheb_poly_eva(float *coef,float x,int order);
 };